@@ -49,10 +49,26 @@ extern "C" {
 struct kahypar_context_s;
 typedef struct kahypar_context_s kahypar_context_t;
 
+struct kahypar_hypergraph_s;
+typedef struct kahypar_hypergraph_s kahypar_hypergraph_t;
+
+/*
+ * If the library was built with the CMake option KAHYPAR_USE_64_BIT_IDS,
+ * KAHYPAR_USE_64_BIT_IDS also has to be defined when including this header.
+ * Targets linking against the kahypar CMake target inherit the definition,
+ * and the installed libkahypar.pc adds it to the compiler flags.
+ */
+#ifdef KAHYPAR_USE_64_BIT_IDS
+typedef uint64_t kahypar_hypernode_id_t;
+typedef uint64_t kahypar_hyperedge_id_t;
+typedef int64_t kahypar_hypernode_weight_t;
+typedef int64_t kahypar_hyperedge_weight_t;
+#else
 typedef unsigned int kahypar_hypernode_id_t;
 typedef unsigned int kahypar_hyperedge_id_t;
 typedef int kahypar_hypernode_weight_t;
 typedef int kahypar_hyperedge_weight_t;
+#endif
 typedef unsigned int kahypar_partition_id_t;
 
 KAHYPAR_API kahypar_context_t* kahypar_context_new();
@@ -82,6 +98,32 @@ KAHYPAR_API void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
                                    kahypar_context_t* kahypar_context,
                                    kahypar_partition_id_t* partition);
 
+/*
+ * Hypergraph handles can be used to partition the same hypergraph multiple times
+ * (e.g., with different numbers of blocks, imbalance parameters or seeds) without
+ * having to construct the internal hypergraph data structure on each call.
+ * Only the hypergraph itself is cached: the data structures used during coarsening,
+ * initial partitioning and refinement are still set up by each partitioning call.
+ * Each call only fixes the vertices given by the fixed vertex file of its context.
+ * Weight arrays may be nullptr, in which case unit weights are used.
+ */
+KAHYPAR_API kahypar_hypergraph_t* kahypar_create_hypergraph(const kahypar_partition_id_t num_blocks,
+                                                            const kahypar_hypernode_id_t num_vertices,
+                                                            const kahypar_hyperedge_id_t num_hyperedges,
+                                                            const size_t* hyperedge_indices,
+                                                            const kahypar_hyperedge_id_t* hyperedges,
+                                                            const kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                            const kahypar_hypernode_weight_t* vertex_weights);
+
+KAHYPAR_API void kahypar_hypergraph_free(kahypar_hypergraph_t* kahypar_hypergraph);
+
+KAHYPAR_API void kahypar_partition_hypergraph(kahypar_hypergraph_t* kahypar_hypergraph,
+                                              const kahypar_partition_id_t num_blocks,
+                                              const double epsilon,
+                                              kahypar_hyperedge_weight_t* objective,
+                                              kahypar_context_t* kahypar_context,
+                                              kahypar_partition_id_t* partition);
+
 KAHYPAR_API void kahypar_improve_partition(const kahypar_hypernode_id_t num_vertices,
                                            const kahypar_hyperedge_id_t num_hyperedges,
                                            const double epsilon,
@@ -118,6 +160,9 @@ KAHYPAR_API void kahypar_set_context_partition_global_search_iterations(kahypar_
 KAHYPAR_API void kahypar_set_context_partition_time_limit(kahypar_context_t* kahypar_context,
 							  int time_limit);
 
+KAHYPAR_API void kahypar_set_context_partition_time_limited_repeated_partitioning(kahypar_context_t* kahypar_context,
+										  bool time_limited_repeated_partitioning);
+
 KAHYPAR_API void kahypar_set_context_partition_max_part_weights(kahypar_context_t* kahypar_context,
 								kahypar_hypernode_weight_t* max_part_weights);
 
@@ -145,6 +190,27 @@ KAHYPAR_API void kahypar_set_context_partition_fixed_vertex_filename(kahypar_con
 KAHYPAR_API void kahypar_set_context_partition_input_partition_filename(kahypar_context_t* kahypar_context,
 									const char* input_partition_filename);
 
+KAHYPAR_API void kahypar_set_context_shared_memory_num_threads(kahypar_context_t* kahypar_context,
+							       size_t num_threads);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_recursive_bisection(kahypar_context_t* kahypar_context,
+									    bool parallel_recursive_bisection);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_initial_partitioning_pool(kahypar_context_t* kahypar_context,
+										  bool parallel_initial_partitioning_pool);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_community_detection(kahypar_context_t* kahypar_context,
+									    bool parallel_community_detection);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_min_hash_sparsifier(kahypar_context_t* kahypar_context,
+									    bool parallel_min_hash_sparsifier);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_deduplication(kahypar_context_t* kahypar_context,
+								      bool parallel_deduplication);
+
+KAHYPAR_API void kahypar_set_context_shared_memory_parallel_flow_refinement(kahypar_context_t* kahypar_context,
+									bool parallel_flow_refinement);
+
 KAHYPAR_API void kahypar_set_context_preprocessing_enable_min_hash_sparsifier(kahypar_context_t* kahypar_context,
 									      bool enable_min_hash_sparsifier);
 
@@ -187,6 +253,9 @@ KAHYPAR_API void kahypar_set_context_preprocessing_community_detection_max_pass_
 KAHYPAR_API void kahypar_set_context_preprocessing_community_detection_min_eps_improvement(kahypar_context_t* kahypar_context,
 											   double min_eps_improvement);
 
+KAHYPAR_API void kahypar_set_context_preprocessing_community_detection_stream_bipartite_graph(kahypar_context_t* kahypar_context,
+											      bool stream_bipartite_graph);
+
 KAHYPAR_API void kahypar_set_context_coarsening_algorithm(kahypar_context_t* kahypar_context,
 							  const char* ctype);
 
@@ -196,6 +265,9 @@ KAHYPAR_API void kahypar_set_context_coarsening_contraction_limit_multiplier(kah
 KAHYPAR_API void kahypar_set_context_coarsening_max_allowed_weight_multiplier(kahypar_context_t* kahypar_context,
 									      double max_allowed_weight_multiplier);
 
+KAHYPAR_API void kahypar_set_context_coarsening_remove_parallel_hes_per_pass(kahypar_context_t* kahypar_context,
+									     bool remove_parallel_hes_per_pass);
+
 KAHYPAR_API void kahypar_set_context_coarsening_RP_rating_function(kahypar_context_t* kahypar_context,
 								   const char* rating_score);
 
@@ -217,6 +289,9 @@ KAHYPAR_API void kahypar_set_context_local_search_algorithm(kahypar_context_t* k
 KAHYPAR_API void kahypar_set_context_local_search_iterations_per_level(kahypar_context_t* kahypar_context,
 								       int iterations_per_level);
 
+KAHYPAR_API void kahypar_set_context_local_search_uncontraction_batch_size(kahypar_context_t* kahypar_context,
+									   size_t uncontraction_batch_size);
+
 KAHYPAR_API void kahypar_set_context_local_search_fm_max_number_of_fruitless_moves(kahypar_context_t* kahypar_context,
 										   uint32_t max_number_of_fruitless_moves);
 
@@ -226,6 +301,12 @@ KAHYPAR_API void kahypar_set_context_local_search_fm_adaptive_stopping_alpha(kah
 KAHYPAR_API void kahypar_set_context_local_search_fm_stopping_rule(kahypar_context_t* kahypar_context,
 								   const char* stopfm);
 
+KAHYPAR_API void kahypar_set_context_local_search_fm_priority_queue(kahypar_context_t* kahypar_context,
+								    const char* pq);
+
+KAHYPAR_API void kahypar_set_context_local_search_fm_max_bucket_queue_gain(kahypar_context_t* kahypar_context,
+									   kahypar_hyperedge_weight_t max_bucket_queue_gain);
+
 KAHYPAR_API void kahypar_set_context_local_search_execution_policy(kahypar_context_t* kahypar_context,
 								   const char* ftype);
 
@@ -29,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/binary_heap.h"
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
@@ -311,5 +312,118 @@ void swap(EnhancedBucketQueue<IDType, KeyType, MetaKey>& a,
           EnhancedBucketQueue<IDType, KeyType, MetaKey>& b) {
   a.swap(b);
 }
+
+// Uses an EnhancedBucketQueue if the key range is at most max_bucket_queue_gain
+// and a BinaryMaxHeap otherwise, because a bucket queue allocates one bucket per
+// possible key. The unused queue is constructed empty.
+template <typename IDType = Mandatory,
+          typename KeyType = Mandatory,
+          typename MetaKey = std::numeric_limits<KeyType> >
+class BucketQueueWithHeapFallback {
+ private:
+  using BucketQueue = EnhancedBucketQueue<IDType, KeyType, MetaKey>;
+  using Heap = BinaryMaxHeap<IDType, KeyType>;
+
+ public:
+  using value_type = IDType;
+  using key_type = KeyType;
+  using meta_key_type = MetaKey;
+  using data_type = void;
+
+  BucketQueueWithHeapFallback(const IDType max_size, const KeyType max_gain,
+                              const KeyType max_bucket_queue_gain) :
+    _uses_buckets(max_gain <= max_bucket_queue_gain),
+    _bucket_queue(_uses_buckets ? max_size : 0, _uses_buckets ? max_gain : 0),
+    _heap(_uses_buckets ? 0 : max_size) { }
+
+  BucketQueueWithHeapFallback(const BucketQueueWithHeapFallback&) = delete;
+  BucketQueueWithHeapFallback& operator= (const BucketQueueWithHeapFallback&) = delete;
+
+  BucketQueueWithHeapFallback(BucketQueueWithHeapFallback&&) = default;
+  BucketQueueWithHeapFallback& operator= (BucketQueueWithHeapFallback&&) = default;
+
+  ~BucketQueueWithHeapFallback() = default;
+
+  bool usesBuckets() const {
+    return _uses_buckets;
+  }
+
+  IDType size() const {
+    return _uses_buckets ? _bucket_queue.size() : _heap.size();
+  }
+
+  bool empty() const {
+    return _uses_buckets ? _bucket_queue.empty() : _heap.empty();
+  }
+
+  KeyType getKey(const IDType id) const {
+    return _uses_buckets ? _bucket_queue.getKey(id) : _heap.getKey(id);
+  }
+
+  bool contains(const IDType id) const {
+    return _uses_buckets ? _bucket_queue.contains(id) : _heap.contains(id);
+  }
+
+  KeyType topKey() const {
+    return _uses_buckets ? _bucket_queue.topKey() : _heap.topKey();
+  }
+
+  IDType top() const {
+    return _uses_buckets ? _bucket_queue.top() : _heap.top();
+  }
+
+  void push(const IDType id, const KeyType key) {
+    if (_uses_buckets) {
+      _bucket_queue.push(id, key);
+    } else {
+      _heap.push(id, key);
+    }
+  }
+
+  void pop() {
+    if (_uses_buckets) {
+      _bucket_queue.pop();
+    } else {
+      _heap.pop();
+    }
+  }
+
+  void updateKey(const IDType id, const KeyType new_key) {
+    if (_uses_buckets) {
+      _bucket_queue.updateKey(id, new_key);
+    } else {
+      _heap.updateKey(id, new_key);
+    }
+  }
+
+  void updateKeyBy(const IDType id, const KeyType key_delta) {
+    if (_uses_buckets) {
+      _bucket_queue.updateKeyBy(id, key_delta);
+    } else {
+      _heap.updateKeyBy(id, key_delta);
+    }
+  }
+
+  void remove(const IDType id) {
+    if (_uses_buckets) {
+      _bucket_queue.remove(id);
+    } else {
+      _heap.remove(id);
+    }
+  }
+
+  void clear() {
+    if (_uses_buckets) {
+      _bucket_queue.clear();
+    } else {
+      _heap.clear();
+    }
+  }
+
+ private:
+  bool _uses_buckets;
+  BucketQueue _bucket_queue;
+  Heap _heap;
+};
 }  // namespace ds
 }  // namespace kahypar
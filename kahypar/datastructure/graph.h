@@ -37,6 +37,7 @@
 #include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -112,7 +113,11 @@ class Graph {
     _incident_cluster_weight(),
     _incident_cluster_weight_position(static_cast<size_t>(hypergraph.initialNumNodes()) +
                                       hypergraph.initialNumEdges()),
-    _hypernode_mapping() {
+    _hypernode_mapping(),
+    _hypergraph(nullptr),
+    _edge_weight_type(context.preprocessing.community_detection.edge_weight),
+    _first_hyperedge_node(0),
+    _original_id() {
     for (const HyperedgeID he : hypergraph.edges()) {
       if (hypergraph.edgeSize(he) > 2) {
         _is_graph = false;
@@ -137,13 +142,21 @@ class Graph {
                                 kInvalidNode);
     }
 
+    if (!_is_graph && context.preprocessing.community_detection.stream_bipartite_graph) {
+      _hypergraph = &hypergraph;
+    }
+
     _num_communities = _num_nodes;
-    _adj_array.resize(_num_nodes + 1);
-    _selfloop_weight.resize(_num_nodes, 0.0L);
+    // A bipartite graph view has no self loops and initializes its
+    // incident cluster weight buffer in initializeBipartiteGraphView.
+    if (_hypergraph == nullptr) {
+      _adj_array.resize(_num_nodes + 1);
+      _selfloop_weight.resize(_num_nodes, 0.0L);
+      _incident_cluster_weight.resize(_num_nodes, IncidentClusterWeight(0, 0.0L));
+    }
     _weighted_degree.resize(_num_nodes, 0.0L);
     _cluster_id.resize(_num_nodes);
     _cluster_size.resize(_num_nodes, 1);
-    _incident_cluster_weight.resize(_num_nodes, IncidentClusterWeight(0, 0.0L));
     std::iota(_cluster_id.begin(), _cluster_id.end(), 0);
 
     if (_is_graph) {
@@ -152,6 +165,20 @@ class Graph {
                                      const HypernodeID) {
             return static_cast<EdgeWeight>(hg.edgeWeight(he));
           });
+    } else if (_hypergraph != nullptr) {
+      switch (_edge_weight_type) {
+        case LouvainEdgeWeight::degree:
+        case LouvainEdgeWeight::non_uniform:
+        case LouvainEdgeWeight::uniform:
+          initializeBipartiteGraphView(hypergraph);
+          break;
+        case LouvainEdgeWeight::hybrid:
+          LOG << "Only uniform/non-uniform/degree edge weight is allowed at graph construction.";
+          std::exit(-1);
+        default:
+          LOG << "Unknown edge weight for bipartite graph.";
+          std::exit(-1);
+      }
     } else {
       switch (context.preprocessing.community_detection.edge_weight) {
         case LouvainEdgeWeight::degree:
@@ -203,7 +230,11 @@ class Graph {
     _cluster_size(_num_nodes, 1),
     _incident_cluster_weight(_num_nodes, IncidentClusterWeight(0, 0.0L)),
     _incident_cluster_weight_position(_num_nodes),
-    _hypernode_mapping(_num_nodes, kInvalidNode) {
+    _hypernode_mapping(_num_nodes, kInvalidNode),
+    _hypergraph(nullptr),
+    _edge_weight_type(LouvainEdgeWeight::UNDEFINED),
+    _first_hyperedge_node(0),
+    _original_id() {
     std::iota(_cluster_id.begin(), _cluster_id.end(), 0);
     std::iota(_hypernode_mapping.begin(), _hypernode_mapping.end(), 0);
 
@@ -232,31 +263,98 @@ class Graph {
 
   std::pair<EdgeIterator, EdgeIterator> incidentEdges(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
+    ASSERT(!isBipartiteGraphView(), "Edges of a bipartite graph view are not stored");
     return std::make_pair(_edges.cbegin() + _adj_array[node],
                           _edges.cbegin() + _adj_array[static_cast<size_t>(node) + 1]);
   }
 
   EdgeIterator firstEdge(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
+    ASSERT(!isBipartiteGraphView(), "Edges of a bipartite graph view are not stored");
     return _edges.cbegin() + _adj_array[node];
   }
 
   EdgeIterator firstInvalidEdge(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
+    ASSERT(!isBipartiteGraphView(), "Edges of a bipartite graph view are not stored");
     return _edges.cbegin() + _adj_array[static_cast<size_t>(node) + 1];
   }
 
+  /**
+   * Calls f(e) for each edge e incident to node. In contrast to incidentEdges, this also
+   * works for bipartite graph views, whose edges are derived from the hypergraph on the fly.
+   */
+  template <typename F>
+  void forEachIncidentEdge(const NodeID node, F&& f) const {
+    forEachIncidentEdgeUntil(node, [&](const Edge& e) {
+        f(e);
+        return false;
+      });
+  }
+
+  /**
+   * Same as forEachIncidentEdge, but stops as soon as f(e) returns true.
+   * @return true, if the iteration was stopped early
+   */
+  template <typename F>
+  bool forEachIncidentEdgeUntil(const NodeID node, F&& f) const {
+    ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
+    if (!isBipartiteGraphView()) {
+      for (const Edge& e : incidentEdges(node)) {
+        if (f(e)) {
+          return true;
+        }
+      }
+    } else if (node < _first_hyperedge_node) {
+      const HypernodeID hn = _original_id[node];
+      const size_t num_hypernodes = _hypergraph->initialNumNodes();
+      Edge e;
+      for (const HyperedgeID& he : _hypergraph->incidentEdges(hn)) {
+        e.target_node = _hypernode_mapping[num_hypernodes + he];
+        e.weight = bipartiteEdgeWeight(he, hn);
+        if (f(static_cast<const Edge&>(e))) {
+          return true;
+        }
+      }
+    } else {
+      const HyperedgeID he = _original_id[node];
+      Edge e;
+      for (const HypernodeID& hn : _hypergraph->pins(he)) {
+        e.target_node = _hypernode_mapping[hn];
+        e.weight = bipartiteEdgeWeight(he, hn);
+        if (f(static_cast<const Edge&>(e))) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // A bipartite graph view does not store its edges explicitly, but derives them
+  // from the incidence structure of the hypergraph it was constructed from.
+  bool isBipartiteGraphView() const {
+    return _hypergraph != nullptr;
+  }
+
 
   size_t numNodes() const {
     return static_cast<size_t>(_num_nodes);
   }
 
   size_t numEdges() const {
+    if (isBipartiteGraphView()) {
+      return 2 * static_cast<size_t>(_hypergraph->currentNumPins());
+    }
     return _edges.size();
   }
 
   size_t degree(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
+    if (isBipartiteGraphView()) {
+      return node < _first_hyperedge_node ?
+             static_cast<size_t>(_hypergraph->nodeDegree(_original_id[node])) :
+             static_cast<size_t>(_hypergraph->edgeSize(_original_id[node]));
+    }
     return static_cast<size_t>(_adj_array[static_cast<size_t>(node) + 1] - _adj_array[node]);
   }
 
@@ -267,7 +365,7 @@ class Graph {
 
   EdgeWeight selfloopWeight(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
-    return _selfloop_weight[node];
+    return isBipartiteGraphView() ? 0.0L : _selfloop_weight[node];
   }
 
 
@@ -345,6 +443,24 @@ class Graph {
   }
 
 
+  /**
+   * Assigns all nodes to the clusters given in cluster_id at once. The cluster sizes
+   * and the number of communities are recomputed afterwards.
+   */
+  void setClusterIDs(const std::vector<ClusterID>& cluster_id) {
+    ASSERT(cluster_id.size() == numNodes());
+    std::fill(_cluster_size.begin(), _cluster_size.end(), 0);
+    _num_communities = 0;
+    for (const NodeID& node : nodes()) {
+      const ClusterID cid = cluster_id[node];
+      ASSERT(cid != -1 && static_cast<size_t>(cid) < numNodes(), V(cid));
+      _cluster_id[node] = cid;
+      if (_cluster_size[cid]++ == 0) {
+        ++_num_communities;
+      }
+    }
+  }
+
   /**
    * Creates an iterator to all incident Clusters of Node node. Iterator points to an
    * IncidentClusterWeight-Struct which contains the incident Cluster ID and the sum of
@@ -363,19 +479,19 @@ class Graph {
       _incident_cluster_weight_position[clusterID(node)] = idx++;
     }
 
-    for (const Edge& e : incidentEdges(node)) {
-      const NodeID id = e.target_node;
-      const EdgeWeight w = e.weight;
-      const ClusterID c_id = clusterID(id);
-      if (c_id != -1) {
-        if (_incident_cluster_weight_position.contains(c_id)) {
-          _incident_cluster_weight[_incident_cluster_weight_position[c_id]].weight += w;
-        } else {
-          _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
-          _incident_cluster_weight_position[c_id] = idx++;
+    forEachIncidentEdge(node, [&](const Edge& e) {
+        const NodeID id = e.target_node;
+        const EdgeWeight w = e.weight;
+        const ClusterID c_id = clusterID(id);
+        if (c_id != -1) {
+          if (_incident_cluster_weight_position.contains(c_id)) {
+            _incident_cluster_weight[_incident_cluster_weight_position[c_id]].weight += w;
+          } else {
+            _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
+            _incident_cluster_weight_position[c_id] = idx++;
+          }
         }
-      }
-    }
+      });
 
     HEAVY_DATA_STRUCTURE_ASSERT([&]() {
           const auto incident_cluster_weight_range =
@@ -385,12 +501,12 @@ class Graph {
           if (clusterID(node) != -1) {
             incident_cluster.insert(clusterID(node));
           }
-          for (const Edge& e : incidentEdges(node)) {
-            const ClusterID cid = clusterID(e.target_node);
-            if (cid != -1) {
-              incident_cluster.insert(cid);
-            }
-          }
+          forEachIncidentEdge(node, [&](const Edge& e) {
+              const ClusterID cid = clusterID(e.target_node);
+              if (cid != -1) {
+                incident_cluster.insert(cid);
+              }
+            });
           for (const auto& cluster : incident_cluster_weight_range) {
             const ClusterID cid = cluster.clusterID;
             const EdgeWeight weight = cluster.weight;
@@ -400,12 +516,12 @@ class Graph {
               return false;
             }
             EdgeWeight incident_weight = 0.0L;
-            for (const Edge& e : incidentEdges(node)) {
-              const ClusterID inc_cid = clusterID(e.target_node);
-              if (inc_cid == cid) {
-                incident_weight += e.weight;
-              }
-            }
+            forEachIncidentEdge(node, [&](const Edge& e) {
+                const ClusterID inc_cid = clusterID(e.target_node);
+                if (inc_cid == cid) {
+                  incident_weight += e.weight;
+                }
+              });
             if (std::abs(incident_weight - weight) > kEpsilon) {
               LOG << "Weight calculation of incident cluster" << cid << "failed!";
               LOG << V(incident_weight);
@@ -434,11 +550,13 @@ class Graph {
    * in a single node in the contracted graph. Edges are inserted based on the sum of the weight
    * of all edges which connects two clusters. Also a mapping is created which maps the nodes of
    * the graph to the corresponding contracted nodes.
+   * The edges of the contracted graph are aggregated concurrently by num_threads threads,
+   * each processing a consecutive range of clusters. The result does not depend on num_threads.
    *
    * @return Pair which contains the contracted graph and a mapping from current to nodes to its
    * corresponding contrated nodes.
    */
-  std::pair<Graph, std::vector<NodeID> > contractClusters() {
+  std::pair<Graph, std::vector<NodeID> > contractClusters(const size_t num_threads = 1) {
     std::vector<NodeID> cluster_to_node(numNodes(), kInvalidNode);
     std::vector<NodeID> node_to_contracted_node(numNodes(), kInvalidNode);
     ClusterID new_cid = 0;
@@ -452,11 +570,11 @@ class Graph {
     }
 
     std::vector<NodeID> new_hypernode_mapping(_hypernode_mapping.size(), kInvalidNode);
-    for (HypernodeID hn = 0; hn < _hypernode_mapping.size(); ++hn) {
-      if (_hypernode_mapping[hn] != kInvalidNode) {
-        new_hypernode_mapping[hn] = node_to_contracted_node[_hypernode_mapping[hn]];
-      }
-    }
+    parallel::parallelFor(0, _hypernode_mapping.size(), num_threads, [&](const size_t hn) {
+        if (_hypernode_mapping[hn] != kInvalidNode) {
+          new_hypernode_mapping[hn] = node_to_contracted_node[_hypernode_mapping[hn]];
+        }
+      });
 
     ASSERT([&]() {
           for (HypernodeID hn = 0; hn < _hypernode_mapping.size(); ++hn) {
@@ -475,41 +593,75 @@ class Graph {
     std::vector<ClusterID> clusterID(new_cid);
     std::iota(clusterID.begin(), clusterID.end(), 0);
 
+    // Counting sort of the nodes by their cluster. Nodes of the same cluster
+    // are stored consecutively in order of increasing node IDs.
+    std::vector<NodeID> cluster_begin(static_cast<size_t>(new_cid) + 1, 0);
+    for (const NodeID& node : nodes()) {
+      ++cluster_begin[static_cast<size_t>(_cluster_id[node]) + 1];
+    }
+    std::partial_sum(cluster_begin.begin(), cluster_begin.end(), cluster_begin.begin());
     std::vector<NodeID> node_ids(_num_nodes);
-    std::iota(node_ids.begin(), node_ids.end(), 0);
-
-    std::sort(node_ids.begin(), node_ids.end(), [&](const NodeID& n1, const NodeID& n2) {
-          return _cluster_id[n1] < _cluster_id[n2] || (_cluster_id[n1] == _cluster_id[n2] && n1 < n2);
-        });
-
-    // Add Sentinels
-    node_ids.push_back(_cluster_id.size());
-    _cluster_id.push_back(new_cid);
-
-    std::vector<NodeID> new_adj_array(new_cid + 1, 0);
-    std::vector<Edge> new_edges;
-    size_t start_idx = 0;
-    for (NodeID i = 0; i < _num_nodes + 1; ++i) {
-      if (_cluster_id[node_ids[start_idx]] != _cluster_id[node_ids[i]]) {
-        const ClusterID cid = _cluster_id[node_ids[start_idx]];
-        new_adj_array[cid] = new_edges.size();
-        auto cluster_range = std::make_pair(node_ids.begin() + start_idx,
-                                            node_ids.begin() + i);
-        for (const auto& incident_cluster_weight : incidentClusterWeightOfCluster(cluster_range)) {
-          Edge e;
-          e.target_node = static_cast<NodeID>(incident_cluster_weight.clusterID);
-          e.weight = incident_cluster_weight.weight;
-          new_edges.push_back(e);
-        }
-        start_idx = i;
+    {
+      std::vector<NodeID> next_position(cluster_begin.begin(), cluster_begin.end() - 1);
+      for (const NodeID& node : nodes()) {
+        node_ids[next_position[_cluster_id[node]]++] = node;
       }
     }
 
-    // Remove Sentinels
-    node_ids.pop_back();
-    _cluster_id.pop_back();
+    // Each thread aggregates the edges of a consecutive range of clusters, which
+    // roughly contains the same number of nodes, into its own edge buffer.
+    const size_t threads = std::max(std::min(num_threads, static_cast<size_t>(new_cid)),
+                                    static_cast<size_t>(1));
+    std::vector<ClusterID> first_cluster(threads + 1, new_cid);
+    first_cluster[0] = 0;
+    for (size_t i = 1; i < threads; ++i) {
+      first_cluster[i] = _cluster_id[node_ids[i * _num_nodes / threads]];
+    }
 
-    new_adj_array[new_cid] = new_edges.size();
+    std::vector<NodeID> new_adj_array(static_cast<size_t>(new_cid) + 1, 0);
+    std::vector<std::vector<Edge> > thread_edges(threads);
+    parallel::executeConcurrent(threads, [&](const size_t thread_id) {
+        // The buffer of a bipartite graph view only holds the clusters incident to one node.
+        const bool use_own_buffers = thread_id > 0 || isBipartiteGraphView();
+        std::vector<IncidentClusterWeight> incident_cluster_weight;
+        std::unique_ptr<SparseMap<ClusterID, size_t> > incident_cluster_weight_position;
+        if (use_own_buffers) {
+          incident_cluster_weight.resize(new_cid, IncidentClusterWeight(0, 0.0L));
+          incident_cluster_weight_position =
+            std::make_unique<SparseMap<ClusterID, size_t> >(new_cid);
+        }
+        std::vector<Edge>& edges = thread_edges[thread_id];
+        for (ClusterID cid = first_cluster[thread_id]; cid < first_cluster[thread_id + 1]; ++cid) {
+          const auto cluster_range = std::make_pair(node_ids.cbegin() + cluster_begin[cid],
+                                                    node_ids.cbegin() + cluster_begin[cid + 1]);
+          const auto incident_clusters = !use_own_buffers ?
+                                         incidentClusterWeightOfCluster(cluster_range) :
+                                         incidentClusterWeightOfCluster(cluster_range,
+                                                                        incident_cluster_weight,
+                                                                        *incident_cluster_weight_position);
+          for (const auto& incident_cluster : incident_clusters) {
+            Edge e;
+            e.target_node = static_cast<NodeID>(incident_cluster.clusterID);
+            e.weight = incident_cluster.weight;
+            edges.push_back(e);
+          }
+          new_adj_array[cid + 1] = edges.size();
+        }
+      });
+
+    // Concatenate the edge buffers of all threads.
+    std::vector<size_t> thread_edge_offset(threads + 1, 0);
+    for (size_t i = 0; i < threads; ++i) {
+      thread_edge_offset[i + 1] = thread_edge_offset[i] + thread_edges[i].size();
+    }
+    std::vector<Edge> new_edges(thread_edge_offset[threads]);
+    parallel::executeConcurrent(threads, [&](const size_t thread_id) {
+        std::copy(thread_edges[thread_id].cbegin(), thread_edges[thread_id].cend(),
+                  new_edges.begin() + thread_edge_offset[thread_id]);
+        for (ClusterID cid = first_cluster[thread_id]; cid < first_cluster[thread_id + 1]; ++cid) {
+          new_adj_array[cid + 1] += thread_edge_offset[thread_id];
+        }
+      });
 
     return std::make_pair(Graph(new_adj_array, new_edges, new_hypernode_mapping, clusterID),
                           node_to_contracted_node);
@@ -521,9 +673,9 @@ class Graph {
 
     for (const NodeID& n : nodes()) {
       std::cout << "Node ID:" << n << "(Comm.:" << clusterID(n) << "), Adj. List: ";
-      for (const Edge& e : incidentEdges(n)) {
-        std::cout << "(" << e.target_node << ",w=" << e.weight << ") ";
-      }
+      forEachIncidentEdge(n, [&](const Edge& e) {
+          std::cout << "(" << e.target_node << ",w=" << e.weight << ") ";
+        });
       std::cout << "\n";
     }
   }
@@ -549,7 +701,11 @@ class Graph {
     _cluster_size(_num_nodes, 0),
     _incident_cluster_weight(_num_nodes, IncidentClusterWeight(0, 0.0L)),
     _incident_cluster_weight_position(_num_nodes),
-    _hypernode_mapping(new_hypernode_mapping) {
+    _hypernode_mapping(new_hypernode_mapping),
+    _hypergraph(nullptr),
+    _edge_weight_type(LouvainEdgeWeight::UNDEFINED),
+    _first_hyperedge_node(0),
+    _original_id() {
     for (const NodeID& node : nodes()) {
       if (_cluster_size[_cluster_id[node]] == 0) {
         _num_communities++;
@@ -572,38 +728,51 @@ class Graph {
    */
   std::pair<IncidentClusterWeightIterator,
             IncidentClusterWeightIterator> incidentClusterWeightOfCluster(const std::pair<NodeIterator, NodeIterator>& cluster_range) {
+    ASSERT(!isBipartiteGraphView(), "Buffer of a bipartite graph view is too small for clusters");
+    return incidentClusterWeightOfCluster(cluster_range, _incident_cluster_weight,
+                                          _incident_cluster_weight_position);
+  }
+
+  /**
+   * Same as above, but uses the given buffers instead of the ones of the graph.
+   * Thus, it can be called concurrently with different buffers.
+   */
+  std::pair<IncidentClusterWeightIterator,
+            IncidentClusterWeightIterator> incidentClusterWeightOfCluster(const std::pair<NodeIterator, NodeIterator>& cluster_range,
+                                                                          std::vector<IncidentClusterWeight>& incident_cluster_weight,
+                                                                          SparseMap<ClusterID, size_t>& incident_cluster_weight_position) const {
     ASSERT(std::all_of(cluster_range.first, cluster_range.second,
                        [&](const NodeID i) { return clusterID(i) == clusterID(*cluster_range.first); }));
-    _incident_cluster_weight_position.clear();
+    incident_cluster_weight_position.clear();
     size_t idx = 0;
 
     for (const NodeID& node : cluster_range) {
-      for (const Edge& e : incidentEdges(node)) {
-        const NodeID id = e.target_node;
-        const EdgeWeight w = e.weight;
-        const ClusterID c_id = clusterID(id);
-        if (_incident_cluster_weight_position.contains(c_id)) {
-          const size_t i = _incident_cluster_weight_position[c_id];
-          _incident_cluster_weight[i].weight += w;
-        } else {
-          _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
-          _incident_cluster_weight_position[c_id] = idx++;
-        }
-      }
+      forEachIncidentEdge(node, [&](const Edge& e) {
+          const NodeID id = e.target_node;
+          const EdgeWeight w = e.weight;
+          const ClusterID c_id = clusterID(id);
+          if (incident_cluster_weight_position.contains(c_id)) {
+            const size_t i = incident_cluster_weight_position[c_id];
+            incident_cluster_weight[i].weight += w;
+          } else {
+            incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
+            incident_cluster_weight_position[c_id] = idx++;
+          }
+        });
     }
 
-    auto incident_cluster_weight_range = std::make_pair(_incident_cluster_weight.begin(),
-                                                        _incident_cluster_weight.begin() + idx);
+    auto incident_cluster_weight_range = std::make_pair(incident_cluster_weight.cbegin(),
+                                                        incident_cluster_weight.cbegin() + idx);
 
     ASSERT([&]() {
           std::set<ClusterID> incident_cluster;
           for (const NodeID& node : cluster_range) {
-            for (const Edge& e : incidentEdges(node)) {
-              const ClusterID cid = clusterID(e.target_node);
-              if (cid != -1) {
-                incident_cluster.insert(cid);
-              }
-            }
+            forEachIncidentEdge(node, [&](const Edge& e) {
+                const ClusterID cid = clusterID(e.target_node);
+                if (cid != -1) {
+                  incident_cluster.insert(cid);
+                }
+              });
           }
           for (const auto& cluster : incident_cluster_weight_range) {
             const ClusterID cid = cluster.clusterID;
@@ -614,12 +783,12 @@ class Graph {
             }
             EdgeWeight incident_weight = 0.0L;
             for (const NodeID& node : cluster_range) {
-              for (const Edge& e : incidentEdges(node)) {
-                const ClusterID inc_cid = clusterID(e.target_node);
-                if (inc_cid == cid) {
-                  incident_weight += e.weight;
-                }
-              }
+              forEachIncidentEdge(node, [&](const Edge& e) {
+                  const ClusterID inc_cid = clusterID(e.target_node);
+                  if (inc_cid == cid) {
+                    incident_weight += e.weight;
+                  }
+                });
             }
             if (std::abs(incident_weight - weight) > kEpsilon) {
               LOG << "Weight calculation of incident cluster" << cid << "failed!";
@@ -643,6 +812,52 @@ class Graph {
     return incident_cluster_weight_range;
   }
 
+  EdgeWeight bipartiteEdgeWeight(const HyperedgeID he, const HypernodeID hn) const {
+    const EdgeWeight weight = static_cast<EdgeWeight>(_hypergraph->edgeWeight(he));
+    switch (_edge_weight_type) {
+      case LouvainEdgeWeight::degree:
+        return (weight * static_cast<EdgeWeight>(_hypergraph->nodeDegree(hn))) /
+               static_cast<EdgeWeight>(_hypergraph->edgeSize(he));
+      case LouvainEdgeWeight::non_uniform:
+        return weight / static_cast<EdgeWeight>(_hypergraph->edgeSize(he));
+      default:
+        return weight;
+    }
+  }
+
+  /**
+   * Initializes the bipartite graph view of hg. Nodes are numbered in the same way as in
+   * constructBipartiteGraph and the edge weights are computed on the fly with the same
+   * formulas. Thus, the view is equivalent to the explicitly constructed bipartite graph.
+   */
+  void initializeBipartiteGraphView(const Hypergraph& hg) {
+    const auto num_nodes = static_cast<size_t>(hg.initialNumNodes());
+    _original_id.resize(_num_nodes);
+
+    NodeID cur_node_id = 0;
+    for (const HypernodeID& hn : hg.nodes()) {
+      _hypernode_mapping[hn] = cur_node_id;
+      _original_id[cur_node_id++] = hn;
+    }
+    _first_hyperedge_node = cur_node_id;
+    for (const HyperedgeID& he : hg.edges()) {
+      _hypernode_mapping[num_nodes + he] = cur_node_id;
+      _original_id[cur_node_id++] = he;
+    }
+
+    size_t max_degree = 0;
+    for (const NodeID& node : nodes()) {
+      forEachIncidentEdge(node, [&](const Edge& e) {
+          _total_weight += e.weight;
+          _weighted_degree[node] += e.weight;
+        });
+      max_degree = std::max(max_degree, degree(node));
+    }
+    // incidentClusterWeightOfNode stores at most one entry per incident edge
+    // plus one for the cluster of the node itself.
+    _incident_cluster_weight.resize(max_degree + 1, IncidentClusterWeight(0, 0.0L));
+  }
+
   template <typename EdgeWeightFunction>
   void constructGraph(const Hypergraph& hg, const EdgeWeightFunction& edgeWeight) {
     NodeID sum_edges = 0;
@@ -818,6 +1033,12 @@ class Graph {
   std::vector<IncidentClusterWeight> _incident_cluster_weight;
   SparseMap<ClusterID, size_t> _incident_cluster_weight_position;
   std::vector<NodeID> _hypernode_mapping;
+  // Only used by bipartite graph views: The hypergraph, the edge weight function and
+  // the hypernode (or hyperedge for nodes >= _first_hyperedge_node) of each node.
+  const Hypergraph* _hypergraph;
+  LouvainEdgeWeight _edge_weight_type;
+  NodeID _first_hyperedge_node;
+  std::vector<HypernodeID> _original_id;
 };
 
 constexpr NodeID Graph::kInvalidNode;
@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -36,6 +37,8 @@
 
 #include "kahypar/datastructure/connectivity_sets.h"
 #include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/incident_net_array.h"
+#include "kahypar/datastructure/pin_count_in_part.h"
 #include "kahypar/datastructure/sparse_set.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/empty.h"
@@ -43,6 +46,7 @@
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/parallel.h"
 
 
 namespace kahypar {
@@ -167,11 +171,15 @@ class GenericHypergraph {
      * \param weight The weight of the hypernode/hyperedge
      */
     explicit Vertex(const WeightType weight) :
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
       _incident_nets(),
+#endif
       _weight(weight) { }
 
     Vertex() :
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
       _incident_nets(),
+#endif
       _weight(1) { }
 
     Vertex(const Vertex&) = default;
@@ -198,16 +206,19 @@ class GenericHypergraph {
       _valid = true;
     }
 
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
     IDType size() const {
       ASSERT(!isDisabled());
       return _incident_nets.size();
     }
+#endif
 
     WeightType weight() const {
       ASSERT(!isDisabled());
       return _weight;
     }
 
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
     std::vector<HyperedgeID> & incidentNets() {
       return _incident_nets;
     }
@@ -215,6 +226,7 @@ class GenericHypergraph {
     const std::vector<HyperedgeID> & incidentNets() const {
       return _incident_nets;
     }
+#endif
 
     void setWeight(WeightType weight) {
       ASSERT(!isDisabled());
@@ -222,12 +234,18 @@ class GenericHypergraph {
     }
 
     bool operator== (const Vertex& rhs) const {
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
       return _incident_nets.size() == rhs._incident_nets.size() &&
              _weight == rhs._weight &&
              _valid == rhs._valid &&
              std::is_permutation(_incident_nets.begin(),
                                  _incident_nets.end(),
                                  rhs._incident_nets.begin());
+#else
+      // The incident nets are compared by verifyEquivalenceWithoutPartitionInfo.
+      return _weight == rhs._weight &&
+             _valid == rhs._valid;
+#endif
     }
 
     bool operator!= (const Vertex& rhs) const {
@@ -235,7 +253,9 @@ class GenericHypergraph {
     }
 
  private:
+#ifndef KAHYPAR_USE_INCIDENT_NET_ARRAY
     std::vector<HyperedgeID> _incident_nets;
+#endif
     // ! Hypernode/Hyperedge weight
     WeightType _weight = 1;
     // ! Flag indicating whether or not the element is active.
@@ -460,7 +480,9 @@ class GenericHypergraph {
 
 
   // ! The data type used to incident nets of vertices and pins of nets
-  using VertexID = uint32_t;
+  using VertexID = HypernodeID;
+  static_assert(std::is_same<HypernodeID, HyperedgeID>::value,
+                "Pins of nets and incident nets of vertices are stored in the same array type");
   // ! The data type for hypernodes
   using Hypernode = Vertex<HypernodeTraits, AdditionalHypernodeData>;
   // ! The data type for hyperedges
@@ -622,11 +644,14 @@ class GenericHypergraph {
     _hypernodes(_num_hypernodes, Hypernode(1)),
     _hyperedges(_num_hyperedges, Hyperedge(0, 0, 1)),
     _incidence_array(_num_pins, 0),
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    _incident_nets(),
+#endif
     _communities(_num_hypernodes, 0),
     _fixed_vertices(nullptr),
     _fixed_vertex_part_id(),
     _part_info(_k),
-    _pins_in_part(static_cast<size_t>(_num_hyperedges) * k),
+    _pins_in_part(),
     _connectivity_sets(_num_hyperedges),
     _hes_not_containing_u(_num_hyperedges) {
     VertexID edge_vector_index = 0;
@@ -641,13 +666,7 @@ class GenericHypergraph {
       }
     }
 
-    for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
-      for (VertexID pin_index = index_vector[i]; pin_index <
-           index_vector[static_cast<size_t>(i) + 1]; ++pin_index) {
-        const HypernodeID pin = edge_vector[pin_index];
-        hypernode(pin).incidentNets().push_back(i);
-      }
-    }
+    setupIncidentNets();
 
     // sentinel for peeks during uncontraction
     if (num_hyperedges == 0) {
@@ -655,6 +674,7 @@ class GenericHypergraph {
     } else {
       _hyperedges.emplace_back(hyperedge(_num_hyperedges - 1).firstInvalidEntry(), 0, 0);
     }
+    initializePinCountsInPart();
 
     bool has_hyperedge_weights = false;
     if (hyperedge_weights != nullptr) {
@@ -700,6 +720,9 @@ class GenericHypergraph {
     _hypernodes(),
     _hyperedges(),
     _incidence_array(),
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    _incident_nets(),
+#endif
     _communities(),
     _fixed_vertices(nullptr),
     _fixed_vertex_part_id(),
@@ -737,7 +760,7 @@ class GenericHypergraph {
     for (HypernodeID i = 0; i < _num_hypernodes; ++i) {
       if (!hypernode(i).isDisabled()) {
         LOG << "hypernode" << i
-            << ": degree=" << hypernode(i).size()
+            << ": degree=" << numIncidentNets(i)
             << "weight=" << hypernode(i).weight();
       }
     }
@@ -838,8 +861,12 @@ class GenericHypergraph {
   // ! Returns a for-each iterator-pair to loop over the set of incident hyperedges of hypernode u.
   std::pair<IncidenceIterator, IncidenceIterator> incidentEdges(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    return std::make_pair(_incident_nets.begin(u), _incident_nets.end(u));
+#else
     return std::make_pair(hypernode(u).incidentNets().cbegin(),
                           hypernode(u).incidentNets().cend());
+#endif
   }
 
   // ! Returns a for-each iterator-pair to loop over the set pins of hyperedge e.
@@ -931,7 +958,10 @@ class GenericHypergraph {
       }
     }
 
-    for (const HyperedgeID he : hypernode(v).incidentNets()) {
+    // Connecting nets to u invalidates all iterators into an IncidentNetArray
+    // (see addIncidentNet). Therefore we cannot use iterators to traverse I(v).
+    for (HyperedgeID i = 0; i < numIncidentNets(v); ++i) {
+      const HyperedgeID he = incidentNet(v, i);
       const HypernodeID pins_begin = hyperedge(he).firstEntry();
       const HypernodeID pins_end = hyperedge(he).firstInvalidEntry();
       HypernodeID slot_of_u = pins_end - 1;
@@ -998,11 +1028,10 @@ class GenericHypergraph {
     restoreMemento(memento);
     markIncidentNetsOf(memento.v);
 
-    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
-    size_t incident_hes_end = incident_hes_of_u.size();
+    HyperedgeID incident_hes_end = numIncidentNets(memento.u);
 
-    for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
-      const HyperedgeID he = incident_hes_of_u[incident_hes_it];
+    for (HyperedgeID incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
+      const HyperedgeID he = incidentNet(memento.u, incident_hes_it);
       if (_hes_not_containing_u[he]) {
         // ... then we have to do some kind of restore operation.
         if (hyperedge(he).firstInvalidEntry() < hyperedge(he + 1).firstEntry() &&
@@ -1030,8 +1059,7 @@ class GenericHypergraph {
           changes_v -= pinCountInPart(he, partID(memento.u)) == 2 ? edgeWeight(he) : 0;
           ++_current_num_pins;
         } else {
-          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
-          hypernode(memento.u).incidentNets().pop_back();
+          removeIncidentNetAt(memento.u, incident_hes_it);
           --incident_hes_it;
           --incident_hes_end;
           // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
@@ -1091,11 +1119,10 @@ class GenericHypergraph {
     restoreMemento(memento);
     markIncidentNetsOf(memento.v);
 
-    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
-    size_t incident_hes_end = incident_hes_of_u.size();
+    HyperedgeID incident_hes_end = numIncidentNets(memento.u);
 
-    for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
-      const HyperedgeID he = incident_hes_of_u[incident_hes_it];
+    for (HyperedgeID incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
+      const HyperedgeID he = incidentNet(memento.u, incident_hes_it);
       if (_hes_not_containing_u[he]) {
         // ... then we have to do some kind of restore operation.
         if (hyperedge(he).firstInvalidEntry() < hyperedge(he + 1).firstEntry() &&
@@ -1118,8 +1145,7 @@ class GenericHypergraph {
 
           ++_current_num_pins;
         } else {
-          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
-          hypernode(memento.u).incidentNets().pop_back();
+          removeIncidentNetAt(memento.u, incident_hes_it);
           --incident_hes_it;
           --incident_hes_end;
           // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
@@ -1199,39 +1225,42 @@ class GenericHypergraph {
     ASSERT(from != to, "from part" << from << "==" << to << "part");
     ASSERT(!isFixedVertex(hn), "Hypernode " << hn << " is a fixed vertex");
     updatePartInfo(hn, from, to);
-    for (const HyperedgeID& he : incidentEdges(hn)) {
-      const bool no_pins_left_in_source_part = decrementPinCountInPart(he, from);
-      const bool only_one_pin_in_to_part = incrementPinCountInPart(he, to);
-
-      if ((no_pins_left_in_source_part && !only_one_pin_in_to_part)) {
-        if (pinCountInPart(he, to) == edgeSize(he)) {
-          for (const HypernodeID& pin : pins(he)) {
-            --hypernode(pin).num_incident_cut_hes;
-            if (hypernode(pin).num_incident_cut_hes == 0) {
-              // ASSERT(std::find(non_border_hns_to_remove.cbegin(),
-              //                  non_border_hns_to_remove.cend(), pin) ==
-              //        non_border_hns_to_remove.end(),
-              //        V(pin));
-              non_border_hns_to_remove.push_back(pin);
+    // The layout of the pin counts is resolved once for all incident nets.
+    _pins_in_part.visit([&](auto& pins_in_part) {
+        for (const HyperedgeID& he : incidentEdges(hn)) {
+          const bool no_pins_left_in_source_part = decrementPinCountInPart(pins_in_part, he, from);
+          const bool only_one_pin_in_to_part = incrementPinCountInPart(pins_in_part, he, to);
+
+          if ((no_pins_left_in_source_part && !only_one_pin_in_to_part)) {
+            if (pins_in_part.get(he, to) == edgeSize(he)) {
+              for (const HypernodeID& pin : pins(he)) {
+                --hypernode(pin).num_incident_cut_hes;
+                if (hypernode(pin).num_incident_cut_hes == 0) {
+                  // ASSERT(std::find(non_border_hns_to_remove.cbegin(),
+                  //                  non_border_hns_to_remove.cend(), pin) ==
+                  //        non_border_hns_to_remove.end(),
+                  //        V(pin));
+                  non_border_hns_to_remove.push_back(pin);
+                }
+              }
+            }
+          } else if (!no_pins_left_in_source_part &&
+                     only_one_pin_in_to_part &&
+                     pins_in_part.get(he, from) == edgeSize(he) - 1) {
+            for (const HypernodeID& pin : pins(he)) {
+              ++hypernode(pin).num_incident_cut_hes;
             }
           }
+          /**ASSERT([&]() -> bool {
+             HypernodeID num_pins = 0;
+             for (PartitionID i = 0; i < _k; ++i) {
+             num_pins += pinCountInPart(he, i);
+             }
+             return num_pins == edgeSize(he);
+             } (),
+             "Incorrect calculation of pin counts");**/
         }
-      } else if (!no_pins_left_in_source_part &&
-                 only_one_pin_in_to_part &&
-                 pinCountInPart(he, from) == edgeSize(he) - 1) {
-        for (const HypernodeID& pin : pins(he)) {
-          ++hypernode(pin).num_incident_cut_hes;
-        }
-      }
-      /**ASSERT([&]() -> bool {
-         HypernodeID num_pins = 0;
-         for (PartitionID i = 0; i < _k; ++i) {
-         num_pins += pinCountInPart(he, i);
-         }
-         return num_pins == edgeSize(he);
-         } (),
-         "Incorrect calculation of pin counts");**/
-    }
+      });
     // ASSERT([&]() {
     //    for (const HyperedgeID he : incidentEdges(hn)) {
     //    for (const HypernodeID pin : pins(he)) {
@@ -1269,9 +1298,11 @@ class GenericHypergraph {
     ASSERT(!isFixedVertex(hn) || fixedVertexPartID(hn) == id,
            "Fixed vertex " << hn << " assigned to wrong part " << id);
     updatePartInfo(hn, id);
-    for (const HyperedgeID& he : incidentEdges(hn)) {
-      incrementPinCountInPart(he, id);
-    }
+    _pins_in_part.visit([&](auto& pins_in_part) {
+        for (const HyperedgeID& he : incidentEdges(hn)) {
+          incrementPinCountInPart(pins_in_part, he, id);
+        }
+      });
   }
 
   /*!
@@ -1293,6 +1324,16 @@ class GenericHypergraph {
     _fixed_vertex_total_weight += nodeWeight(hn);
   }
 
+  // ! Removes all fixed vertices. Their block IDs are not changed.
+  void resetFixedVertices() {
+    for (const HypernodeID& hn : fixedVertices()) {
+      _part_info[fixedVertexPartID(hn)].fixed_vertex_weight -= nodeWeight(hn);
+    }
+    _fixed_vertices.reset();
+    std::vector<PartitionID>().swap(_fixed_vertex_part_id);
+    _fixed_vertex_total_weight = 0;
+  }
+
   /*!
    * Removes a hypernode from the hypergraph.
    *
@@ -1356,12 +1397,10 @@ class GenericHypergraph {
     enableEdge(he);
     resetPartitionPinCounts(he);
     for (const HypernodeID& pin : pins(he)) {
-      ASSERT(std::count(hypernode(pin).incidentNets().begin(),
-                        hypernode(pin).incidentNets().end(), he)
-             == 0,
+      ASSERT(std::count(incidentEdges(pin).first, incidentEdges(pin).second, he) == 0,
              "HN" << pin << "is already connected to HE" << he);
       DBG << "re-adding pin" << pin << "to HE" << he;
-      hypernode(pin).incidentNets().push_back(he);
+      addIncidentNet(pin, he);
       if (partID(pin) != kInvalidPartition) {
         incrementPinCountInPart(he, partID(pin));
       }
@@ -1382,12 +1421,10 @@ class GenericHypergraph {
     enableEdge(he);
     resetPartitionPinCounts(he);
     for (const HypernodeID& pin : pins(he)) {
-      ASSERT(std::count(hypernode(pin).incidentNets().begin(),
-                        hypernode(pin).incidentNets().end(), he)
-             == 0,
+      ASSERT(std::count(incidentEdges(pin).first, incidentEdges(pin).second, he) == 0,
              "HN" << pin << "is already connected to HE" << he);
       DBG << "re-adding pin" << pin << "to HE" << he;
-      hypernode(pin).incidentNets().push_back(he);
+      addIncidentNet(pin, he);
       if (partID(pin) != kInvalidPartition) {
         incrementPinCountInPart(he, partID(pin));
       }
@@ -1406,7 +1443,7 @@ class GenericHypergraph {
       hypernode(i).num_incident_cut_hes = 0;
     }
     std::fill(_part_info.begin(), _part_info.end(), PartInfo());
-    std::fill(_pins_in_part.begin(), _pins_in_part.end(), 0);
+    _pins_in_part.reset();
     for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
       hyperedge(i).connectivity = 0;
       _connectivity_sets[i].clear();
@@ -1455,7 +1492,7 @@ class GenericHypergraph {
   // internal data structures accordingly.
   void changeK(const PartitionID k) {
     _k = k;
-    _pins_in_part.resize(static_cast<size_t>(_num_hyperedges) * k, 0);
+    initializePinCountsInPart();
     _part_info.resize(k, PartInfo());
     _connectivity_sets.resize(_num_hyperedges);
   }
@@ -1470,7 +1507,7 @@ class GenericHypergraph {
 
   HyperedgeID nodeDegree(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
-    return hypernode(u).size();
+    return numIncidentNets(u);
   }
 
   HypernodeID edgeSize(const HyperedgeID e) const {
@@ -1483,6 +1520,11 @@ class GenericHypergraph {
     return hyperedge(e).hash;
   }
 
+  size_t edgeHash(const HyperedgeID e) const {
+    ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
+    return hyperedge(e).hash;
+  }
+
   HypernodeWeight nodeWeight(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
     return hypernode(u).weight();
@@ -1708,8 +1750,8 @@ class GenericHypergraph {
   HypernodeID pinCountInPart(const HyperedgeID he, const PartitionID id) const {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
     ASSERT(id < _k && id != kInvalidPartition, "Partition ID" << id << "is out of bounds");
-    ASSERT(_pins_in_part[static_cast<size_t>(he) * _k + id] != kInvalidCount, V(he) << V(id));
-    return _pins_in_part[static_cast<size_t>(he) * _k + id];
+    ASSERT(_pins_in_part.get(he, id) != kInvalidCount, V(he) << V(id));
+    return _pins_in_part.get(he, id);
   }
 
   bool inPart(const HypernodeID hn, const PartitionID b) const {
@@ -1820,6 +1862,7 @@ class GenericHypergraph {
   FRIEND_TEST(AHypergraph, WithContractedHypernodesCanBeReindexed);
   FRIEND_TEST(AHypergraph,
               WithOnePartitionEqualsTheExtractedHypergraphExceptForPartitionRelatedInfos);
+  FRIEND_TEST(Hypergraphs, StorePinCountsSparselyForLargeK);
 
   /*!
    * Returns true if hypernode is a border-node.
@@ -1875,14 +1918,20 @@ class GenericHypergraph {
 
   // ! Decrements the number of pins of a hyperedge in a block by one.
   bool decrementPinCountInPart(const HyperedgeID he, const PartitionID id) {
+    return _pins_in_part.visit([&](auto& pins_in_part) {
+        return decrementPinCountInPart(pins_in_part, he, id);
+      });
+  }
+
+  // ! Same as above, but uses the layout of the pin counts resolved by the caller.
+  template <typename PinCounts>
+  bool decrementPinCountInPart(PinCounts& pins_in_part, const HyperedgeID he,
+                               const PartitionID id) {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
     ASSERT(pinCountInPart(he, id) > 0,
            "HE" << he << "does not have any pins in partition" << id);
     ASSERT(id < _k && id != kInvalidPartition, "Part ID" << id << "out of bounds!");
-    ASSERT(_pins_in_part[static_cast<size_t>(he) * _k + id] > 0, "invalid decrease");
-    const size_t offset = static_cast<size_t>(he) * _k + id;
-    _pins_in_part[offset] -= 1;
-    const bool connectivity_decreased = _pins_in_part[offset] == 0;
+    const bool connectivity_decreased = pins_in_part.decrement(he, id) == 0;
     if (connectivity_decreased) {
       _connectivity_sets[he].remove(id);
       hyperedge(he).connectivity -= 1;
@@ -1892,14 +1941,21 @@ class GenericHypergraph {
 
   // ! Increments the number of pins of a hyperedge in a block by one
   bool incrementPinCountInPart(const HyperedgeID he, const PartitionID id) {
+    return _pins_in_part.visit([&](auto& pins_in_part) {
+        return incrementPinCountInPart(pins_in_part, he, id);
+      });
+  }
+
+  // ! Same as above, but uses the layout of the pin counts resolved by the caller.
+  template <typename PinCounts>
+  bool incrementPinCountInPart(PinCounts& pins_in_part, const HyperedgeID he,
+                               const PartitionID id) {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
     ASSERT(pinCountInPart(he, id) <= edgeSize(he),
            "HE" << he << ": pin_count[" << id << "]=" << pinCountInPart(he, id)
                 << "edgesize=" << edgeSize(he));
     ASSERT(id < _k && id != kInvalidPartition, "Part ID" << id << "out of bounds!");
-    const size_t offset = static_cast<size_t>(he) * _k + id;
-    _pins_in_part[offset] += 1;
-    const bool connectivity_increased = _pins_in_part[offset] == 1;
+    const bool connectivity_increased = pins_in_part.increment(he, id) == 1;
     if (connectivity_increased) {
       hyperedge(he).connectivity += 1;
       _connectivity_sets[he].add(id);
@@ -1911,9 +1967,7 @@ class GenericHypergraph {
   void invalidatePartitionPinCounts(const HyperedgeID he) {
     ASSERT(hyperedge(he).isDisabled(),
            "Invalidation of pin counts only allowed for disabled hyperedges");
-    for (PartitionID part = 0; part < _k; ++part) {
-      _pins_in_part[static_cast<size_t>(he) * _k + part] = kInvalidCount;
-    }
+    _pins_in_part.invalidate(he);
     hyperedge(he).connectivity = 0;
     _connectivity_sets[he].clear();
   }
@@ -1921,9 +1975,7 @@ class GenericHypergraph {
   // ! Resets the number of pins in each block to zero.
   void resetPartitionPinCounts(const HyperedgeID he) {
     ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
-    for (PartitionID part = 0; part < _k; ++part) {
-      _pins_in_part[static_cast<size_t>(he) * _k + part] = 0;
-    }
+    _pins_in_part.reset(he);
   }
 
   void enableEdge(const HyperedgeID e) {
@@ -1979,7 +2031,7 @@ class GenericHypergraph {
     // that u is now connected to e and add the edge (u,e) to indicate this conection also from
     // the hypernode's point of view.
     _incidence_array[hyperedge(e).firstInvalidEntry() - 1] = u;
-    hypernode(u).incidentNets().push_back(e);
+    addIncidentNet(u, e);
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void markIncidentNetsOf(const HypernodeID v) {
@@ -2021,9 +2073,11 @@ class GenericHypergraph {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void removeIncidentEdgeFromHypernode(const HyperedgeID he,
                                                                        const HypernodeID hn) {
-    using std::swap;
     ASSERT(!hypernode(hn).isDisabled());
-
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    _incident_nets.remove(hn, he);
+#else
+    using std::swap;
     auto begin = hypernode(hn).incidentNets().begin();
     ASSERT(hypernode(hn).size() > 0);
     auto last_entry = hypernode(hn).incidentNets().end() - 1;
@@ -2033,6 +2087,79 @@ class GenericHypergraph {
     ASSERT(begin < hypernode(hn).incidentNets().end());
     swap(*begin, *last_entry);
     hypernode(hn).incidentNets().pop_back();
+#endif
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeID numIncidentNets(const HypernodeID u) const {
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    return _incident_nets.size(u);
+#else
+    return hypernode(u).size();
+#endif
+  }
+
+  // ! Returns the i-th incident net of hypernode u
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeID incidentNet(const HypernodeID u,
+                                                          const HyperedgeID i) const {
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    return _incident_nets.get(u, i);
+#else
+    return hypernode(u).incidentNets()[i];
+#endif
+  }
+
+  /*!
+   * Appends he to I(u).
+   * With KAHYPAR_USE_INCIDENT_NET_ARRAY, this invalidates the incidentEdges()
+   * iterators of all hypernodes, because the region of u might be moved.
+   * The only callers are contract() (which traverses I(v) by index) and
+   * restoreEdge() (which only traverses the pins of the restored hyperedge).
+   * Otherwise, only the iterators of I(u) are invalidated.
+   */
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void addIncidentNet(const HypernodeID u, const HyperedgeID he) {
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    _incident_nets.push_back(u, he);
+#else
+    hypernode(u).incidentNets().push_back(he);
+#endif
+  }
+
+  // ! Removes the i-th incident net of u by swapping it with the last entry.
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void removeIncidentNetAt(const HypernodeID u,
+                                                           const HyperedgeID i) {
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    _incident_nets.removeAt(u, i);
+#else
+    std::swap(hypernode(u).incidentNets()[i], hypernode(u).incidentNets().back());
+    hypernode(u).incidentNets().pop_back();
+#endif
+  }
+
+  // ! Initializes the pin counts of all hyperedges for _k blocks.
+  void initializePinCountsInPart() {
+    _pins_in_part.initialize(_num_hyperedges, _k, [&](const HyperedgeID he) {
+        // The sentinel ensures that hyperedge(he + 1) exists. Since hyperedges
+        // never grow beyond their original size, this is an upper bound for |he|.
+        return hyperedge(he + 1).firstEntry() - hyperedge(he).firstEntry();
+      });
+  }
+
+  // ! Builds the incident nets of all hypernodes from the pins of all enabled hyperedges.
+  void setupIncidentNets() {
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+    std::vector<HyperedgeID> degrees(_num_hypernodes, 0);
+    for (const HyperedgeID& he : edges()) {
+      for (const HypernodeID& pin : pins(he)) {
+        ++degrees[pin];
+      }
+    }
+    _incident_nets.initialize(degrees);
+#endif
+    for (const HyperedgeID& he : edges()) {
+      for (const HypernodeID& pin : pins(he)) {
+        addIncidentNet(pin, he);
+      }
+    }
   }
 
 
@@ -2121,6 +2248,11 @@ class GenericHypergraph {
   // ! Incidence structure containing the ids of of pins of all hyperedges
   // ! and the ids of the incident edges of all hypernodes.
   std::vector<VertexID> _incidence_array;
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+  // ! Incident nets of all hypernodes, stored contiguously with slack for
+  // ! contractions. Otherwise, each hypernode stores its incident nets itself.
+  IncidentNetArray<HypernodeID, HyperedgeID> _incident_nets;
+#endif
   // ! Stores the community structure revealed by community detection algorithms.
   // ! If community detection is disabled, all HNs are in the same community.
   std::vector<PartitionID> _communities;
@@ -2132,7 +2264,7 @@ class GenericHypergraph {
   // ! Weight and size information for all blocks.
   std::vector<PartInfo> _part_info;
   // ! For each hyperedge and each block, _pins_in_part stores the number of pins in that block
-  std::vector<HypernodeID> _pins_in_part;
+  PinCountInPart<HypernodeID, HyperedgeID, PartitionID> _pins_in_part;
   // ! For each hyperedge, _connectivity_sets stores the blocks the hyperedge connects
   ConnectivitySets<PartitionID, HyperedgeID> _connectivity_sets;
 
@@ -2198,14 +2330,27 @@ bool verifyEquivalenceWithoutPartitionInfo(const Hypergraph& expected, const Hyp
   ASSERT(expected._hyperedges == actual._hyperedges, "Error!");
   ASSERT(expected._communities == actual._communities, "Error!");
 
-  std::vector<unsigned int> expected_incidence_array(expected._incidence_array);
-  std::vector<unsigned int> actual_incidence_array(actual._incidence_array);
+  std::vector<typename Hypergraph::HypernodeID> expected_incidence_array(expected._incidence_array);
+  std::vector<typename Hypergraph::HypernodeID> actual_incidence_array(actual._incidence_array);
   std::sort(expected_incidence_array.begin(), expected_incidence_array.end());
   std::sort(actual_incidence_array.begin(), actual_incidence_array.end());
 
   ASSERT(expected_incidence_array == actual_incidence_array,
          "expected._incidence_array != actual._incidence_array");
 
+  bool incident_nets_valid = expected._num_hypernodes == actual._num_hypernodes;
+#ifdef KAHYPAR_USE_INCIDENT_NET_ARRAY
+  // Otherwise, the incident nets are compared as part of the hypernodes.
+  for (typename Hypergraph::HypernodeID hn = 0; incident_nets_valid &&
+       hn < expected._num_hypernodes; ++hn) {
+    ASSERT(expected._incident_nets.isPermutation(hn, actual._incident_nets, hn), V(hn));
+    if (!expected._incident_nets.isPermutation(hn, actual._incident_nets, hn)) {
+      incident_nets_valid = false;
+      break;
+    }
+  }
+#endif
+
   return expected._num_hypernodes == actual._num_hypernodes &&
          expected._num_hyperedges == actual._num_hyperedges &&
          expected._num_pins == actual._num_pins &&
@@ -2217,7 +2362,8 @@ bool verifyEquivalenceWithoutPartitionInfo(const Hypergraph& expected, const Hyp
          expected._hypernodes == actual._hypernodes &&
          expected._hyperedges == actual._hyperedges &&
          expected._communities == actual._communities &&
-         expected_incidence_array == actual_incidence_array;
+         expected_incidence_array == actual_incidence_array &&
+         incident_nets_valid;
 }
 
 template <typename Hypergraph>
@@ -2327,7 +2473,6 @@ reindex(const Hypergraph& hypergraph) {
 
   ASSERT(reindexed_hypergraph->_incidence_array.size() == num_pins);
   reindexed_hypergraph->_incidence_array.resize(num_pins);
-  reindexed_hypergraph->_pins_in_part.resize(static_cast<size_t>(num_hyperedges) * hypergraph._k);
   reindexed_hypergraph->_hes_not_containing_u.setSize(num_hyperedges);
 
   reindexed_hypergraph->_connectivity_sets.initialize(num_hyperedges);
@@ -2342,11 +2487,7 @@ reindex(const Hypergraph& hypergraph) {
   reindexed_hypergraph->_total_weight +=
     reindexed_hypergraph->hypernode(num_hypernodes - 1).weight();
 
-  for (const HyperedgeID& he : reindexed_hypergraph->edges()) {
-    for (const HypernodeID& pin : reindexed_hypergraph->pins(he)) {
-      reindexed_hypergraph->hypernode(pin).incidentNets().push_back(he);
-    }
-  }
+  reindexed_hypergraph->setupIncidentNets();
 
   reindexed_hypergraph->_part_info.resize(reindexed_hypergraph->_k);
   for (const HypernodeID& hn : reindexed_hypergraph->nodes()) {
@@ -2363,6 +2504,7 @@ reindex(const Hypergraph& hypergraph) {
     reindexed_hypergraph->_hyperedges.emplace_back(
       reindexed_hypergraph->hyperedge(num_hyperedges - 1).firstInvalidEntry(), 0, 0);
   }
+  reindexed_hypergraph->initializePinCountsInPart();
 
   return std::make_pair(std::move(reindexed_hypergraph), reindexed_to_original);
 }
@@ -2463,7 +2605,6 @@ static void setupInternalStructure(const Hypergraph& reference,
                                    const typename Hypergraph::HypernodeID num_pins,
                                    const typename Hypergraph::HyperedgeID num_hyperedges) {
   using HypernodeID = typename Hypergraph::HypernodeID;
-  using HyperedgeID = typename Hypergraph::HyperedgeID;
   subhypergraph._k = new_k;
   subhypergraph._num_pins = num_pins;
   subhypergraph._current_num_hypernodes = num_hypernodes;
@@ -2473,8 +2614,6 @@ static void setupInternalStructure(const Hypergraph& reference,
 
   ASSERT(subhypergraph._incidence_array.size() == num_pins);
   subhypergraph._incidence_array.resize(static_cast<size_t>(num_pins));
-  subhypergraph._pins_in_part.resize(static_cast<size_t>(num_hyperedges) *
-                                     static_cast<size_t>(new_k));
   subhypergraph._hes_not_containing_u.setSize(num_hyperedges);
 
   subhypergraph._connectivity_sets.initialize(num_hyperedges);
@@ -2505,11 +2644,7 @@ static void setupInternalStructure(const Hypergraph& reference,
     reference.nodeWeight(mapping[num_hypernodes - 1]));
   subhypergraph._total_weight += subhypergraph.hypernode(num_hypernodes - 1).weight();
 
-  for (const HyperedgeID& he : subhypergraph.edges()) {
-    for (const HypernodeID& pin : subhypergraph.pins(he)) {
-      subhypergraph.hypernode(pin).incidentNets().push_back(he);
-    }
-  }
+  subhypergraph.setupIncidentNets();
 
   // sentinel for peeks during uncontraction
   if (num_hyperedges == 0) {
@@ -2518,6 +2653,7 @@ static void setupInternalStructure(const Hypergraph& reference,
     subhypergraph._hyperedges.emplace_back(
       subhypergraph.hyperedge(num_hyperedges - 1).firstInvalidEntry(), 0, 0);
   }
+  subhypergraph.initializePinCountsInPart();
 }
 
 
@@ -2618,6 +2754,66 @@ static Hypergraph constructDualHypergraph(const Hypergraph& hypergraph) {
                     hyperedge_weights_ptr, hypernode_weights_ptr);
 }
 
+/*!
+ * Creates an independent copy of an unmodified hypergraph.
+ * Besides the incidence structure and the weights, the copy also contains
+ * the fixed vertices, the community structure and the current partition
+ * (if the hypergraph is partitioned).
+ */
+template <typename Hypergraph>
+static Hypergraph copyHypergraph(const Hypergraph& hypergraph) {
+  using HypernodeID = typename Hypergraph::HypernodeID;
+  using HyperedgeID = typename Hypergraph::HyperedgeID;
+  using PartitionID = typename Hypergraph::PartitionID;
+  ALWAYS_ASSERT(!hypergraph.isModified(), "Only unmodified hypergraphs can be copied");
+
+  typename Hypergraph::HyperedgeIndexVector index_vector;
+  typename Hypergraph::HyperedgeVector edge_vector;
+  typename Hypergraph::HyperedgeWeightVector hyperedge_weights;
+  typename Hypergraph::HypernodeWeightVector hypernode_weights;
+
+  index_vector.reserve(static_cast<size_t>(hypergraph.initialNumEdges()) + 1);
+  edge_vector.reserve(hypergraph.initialNumPins());
+  hyperedge_weights.reserve(hypergraph.initialNumEdges());
+  hypernode_weights.reserve(hypergraph.initialNumNodes());
+
+  index_vector.push_back(edge_vector.size());
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      edge_vector.push_back(pin);
+    }
+    index_vector.push_back(edge_vector.size());
+    hyperedge_weights.push_back(hypergraph.edgeWeight(he));
+  }
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypernode_weights.push_back(hypergraph.nodeWeight(hn));
+  }
+
+  Hypergraph copy(hypergraph.initialNumNodes(), hypergraph.initialNumEdges(),
+                  index_vector, edge_vector, hypergraph.k(),
+                  &hyperedge_weights, &hypernode_weights);
+  copy.setType(hypergraph.type());
+
+  for (const HypernodeID& hn : hypergraph.fixedVertices()) {
+    copy.setFixedVertex(hn, hypergraph.fixedVertexPartID(hn));
+  }
+
+  std::vector<PartitionID> communities(hypergraph.communities());
+  copy.setCommunities(std::move(communities));
+
+  bool is_partitioned = false;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    if (hypergraph.partID(hn) != Hypergraph::kInvalidPartition) {
+      copy.setNodePart(hn, hypergraph.partID(hn));
+      is_partitioned = true;
+    }
+  }
+  if (is_partitioned) {
+    copy.initializeNumCutHyperedges();
+  }
+  return copy;
+}
+
 // Implemets a variant of the INRMEM algorithm described in
 // Deveci, Mehmet, Kamer Kaya, and Umit V. Catalyurek. "Hypergraph sparsification and
 // its application to partitioning." Parallel Processing (ICPP),
@@ -2796,5 +2992,166 @@ removeIdenticalNodes(Hypergraph& hypergraph) {
 
   return removed_identical_hns;
 }
+
+// ! Computes the representative of each element in [0, num_elements) as
+// ! defined by removeParallelHyperedges and removeIdenticalNodes: the smallest
+// ! element with the same set of neighbors (i.e., pins or incident nets).
+// ! Fingerprints are computed concurrently, candidates are grouped by sorting
+// ! them by (fingerprint, size, id) in parallel and the groups are verified
+// ! concurrently.
+template <typename ID, typename SizeFunc, typename NeighborsFunc>
+static std::vector<ID> computeRepresentatives(const ID num_elements,
+                                              const size_t num_neighbor_ids,
+                                              const size_t num_threads,
+                                              const SizeFunc& size,
+                                              const NeighborsFunc& neighbors) {
+  struct Candidate {
+    size_t fingerprint;
+    size_t size;
+    ID id;
+
+    bool operator< (const Candidate& other) const {
+      return std::tie(fingerprint, size, id) <
+             std::tie(other.fingerprint, other.size, other.id);
+    }
+  };
+
+  std::vector<Candidate> candidates(num_elements);
+  parallel::parallelFor(0, num_elements, num_threads, [&](const size_t id) {
+      size_t fingerprint = 0;
+      for (const auto neighbor : neighbors(id)) {
+        fingerprint += math::cs2(static_cast<size_t>(neighbor));
+      }
+      candidates[id] = { fingerprint, size(id), static_cast<ID>(id) };
+    });
+  parallel::sort(candidates.begin(), candidates.end(), num_threads, std::less<Candidate>());
+
+  std::vector<size_t> group_begin;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (i == 0 || candidates[i].fingerprint != candidates[i - 1].fingerprint ||
+        candidates[i].size != candidates[i - 1].size) {
+      group_begin.push_back(i);
+    }
+  }
+  group_begin.push_back(candidates.size());
+
+  std::vector<ID> representatives(num_elements);
+  parallel::parallelForBlocks(0, group_begin.size() - 1, num_threads,
+                              [&](const size_t, const size_t begin, const size_t end) {
+      // allocated lazily, since most groups consist of a single candidate
+      ds::FastResetFlagArray<uint64_t> contained_neighbors;
+      bool is_allocated = false;
+      std::vector<ID> group_representatives;
+      for (size_t group = begin; group < end; ++group) {
+        if (group_begin[group + 1] - group_begin[group] > 1 && !is_allocated) {
+          contained_neighbors.setSize(num_neighbor_ids);
+          is_allocated = true;
+        }
+        // Candidates of a group are sorted by ID, i.e., each element is
+        // compared to the representatives with smaller IDs only
+        group_representatives.clear();
+        for (size_t i = group_begin[group]; i < group_begin[group + 1]; ++i) {
+          const ID id = candidates[i].id;
+          representatives[id] = id;
+          for (const ID representative : group_representatives) {
+            contained_neighbors.reset();
+            for (const auto neighbor : neighbors(representative)) {
+              contained_neighbors.set(neighbor, true);
+            }
+            bool is_same = true;
+            for (const auto neighbor : neighbors(id)) {
+              if (!contained_neighbors[neighbor]) {
+                is_same = false;
+                break;
+              }
+            }
+            if (is_same) {
+              representatives[id] = representative;
+              break;
+            }
+          }
+          if (representatives[id] == id) {
+            group_representatives.push_back(id);
+          }
+        }
+      }
+    });
+  return representatives;
+}
+
+// ! Parallel version of removeParallelHyperedges. Removes the same hyperedges
+// ! in the same order as the sequential version.
+template <typename Hypergraph>
+static std::vector<std::pair<typename Hypergraph::HyperedgeID,
+                             typename Hypergraph::HyperedgeID> >
+removeParallelHyperedges(Hypergraph& hypergraph, const size_t num_threads) {
+  typedef typename Hypergraph::HyperedgeID HyperedgeID;
+
+  if (num_threads <= 1) {
+    return removeParallelHyperedges(hypergraph);
+  }
+
+  ASSERT(hypergraph.initialNumEdges() == hypergraph.currentNumEdges(),
+         "Deduplication assumes unmodified hypergraph!");
+
+  const Hypergraph& hg = hypergraph;
+  const std::vector<HyperedgeID> representatives = computeRepresentatives(
+    hg.initialNumEdges(), hg.initialNumNodes(), num_threads,
+    [&](const HyperedgeID he) {
+      return hg.edgeSize(he);
+    },
+    [&](const HyperedgeID he) {
+      return hg.pins(he);
+    });
+
+  std::vector<std::pair<HyperedgeID, HyperedgeID> > removed_parallel_hes;
+
+  for (const auto he : hypergraph.edges()) {
+    if (representatives[he] != he) {
+      removed_parallel_hes.emplace_back(he, representatives[he]);
+      hypergraph.setEdgeWeight(representatives[he],
+                               hypergraph.edgeWeight(representatives[he])
+                               + hypergraph.edgeWeight(he));
+      hypergraph.removeEdge(he);
+    }
+  }
+
+  return removed_parallel_hes;
+}
+
+// ! Parallel version of removeIdenticalNodes. Performs the same contractions
+// ! in the same order as the sequential version.
+template <typename Hypergraph>
+static std::vector<typename Hypergraph::ContractionMemento>
+removeIdenticalNodes(Hypergraph& hypergraph, const size_t num_threads) {
+  typedef typename Hypergraph::HypernodeID HypernodeID;
+
+  if (num_threads <= 1) {
+    return removeIdenticalNodes(hypergraph);
+  }
+
+  ASSERT(hypergraph.initialNumNodes() == hypergraph.currentNumNodes(),
+         "Deduplication assumes unmodified hypergraph!");
+
+  const Hypergraph& hg = hypergraph;
+  const std::vector<HypernodeID> representatives = computeRepresentatives(
+    hg.initialNumNodes(), hg.initialNumEdges(), num_threads,
+    [&](const HypernodeID hn) {
+      return hg.nodeDegree(hn);
+    },
+    [&](const HypernodeID hn) {
+      return hg.incidentEdges(hn);
+    });
+
+  std::vector<typename Hypergraph::ContractionMemento> removed_identical_hns;
+
+  for (const auto hn : hypergraph.nodes()) {
+    if (representatives[hn] != hn) {
+      removed_identical_hns.emplace_back(hypergraph.contract(representatives[hn], hn));
+    }
+  }
+
+  return removed_identical_hns;
+}
 }  // namespace ds
 }  // namespace kahypar
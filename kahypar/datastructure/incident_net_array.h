@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Stores the incident nets I(v) of all hypernodes in one contiguous array.
+ *
+ * Each hypernode owns a region [begin, begin + capacity) of the array, of which
+ * the first size entries are used. Regions are initialized with some slack beyond
+ * the initial degree, so that the representative of a contraction can usually
+ * absorb the nets of its contraction partner in place. If a region overflows,
+ * it is moved to the end of the array with twice its capacity. Once the regions
+ * abandoned this way would make up more than half of the array, all regions are
+ * compacted into a new array instead.
+ *
+ * Note that growing a region may reallocate the array. Thus push_back and reserve
+ * invalidate the iterators of ALL hypernodes, not only those of u.
+ */
+template <typename HypernodeID, typename HyperedgeID>
+class IncidentNetArray {
+ private:
+  struct Header {
+    // ! Index of the first incident net in _nets
+    size_t begin;
+    // ! Number of incident nets
+    HyperedgeID size;
+    // ! Number of entries reserved for the hypernode
+    HyperedgeID capacity;
+  };
+
+ public:
+  using const_iterator = typename std::vector<HyperedgeID>::const_iterator;
+
+  // ! Minimum number of free entries reserved for each hypernode
+  static constexpr HyperedgeID kMinSlack = 2;
+
+  IncidentNetArray() :
+    _headers(),
+    _nets(),
+    _num_abandoned_entries(0) { }
+
+  IncidentNetArray(const IncidentNetArray&) = default;
+  IncidentNetArray& operator= (const IncidentNetArray&) = default;
+
+  IncidentNetArray(IncidentNetArray&&) = default;
+  IncidentNetArray& operator= (IncidentNetArray&&) = default;
+
+  ~IncidentNetArray() = default;
+
+  /*!
+   * Reserves a region for each hypernode u that can hold degrees[u] nets plus
+   * additional slack. All regions are initially empty.
+   */
+  void initialize(const std::vector<HyperedgeID>& degrees) {
+    _headers.resize(degrees.size());
+    size_t begin = 0;
+    for (size_t u = 0; u < degrees.size(); ++u) {
+      const HyperedgeID capacity = degrees[u] + std::max(static_cast<HyperedgeID>(degrees[u] / 2),
+                                                         kMinSlack);
+      _headers[u] = Header { begin, 0, capacity };
+      begin += capacity;
+    }
+    _nets.clear();
+    _nets.resize(begin);
+    _num_abandoned_entries = 0;
+  }
+
+  HyperedgeID size(const HypernodeID u) const {
+    ASSERT(u < _headers.size(), V(u));
+    return _headers[u].size;
+  }
+
+  HyperedgeID capacity(const HypernodeID u) const {
+    ASSERT(u < _headers.size(), V(u));
+    return _headers[u].capacity;
+  }
+
+  const_iterator begin(const HypernodeID u) const {
+    return _nets.cbegin() + _headers[u].begin;
+  }
+
+  const_iterator end(const HypernodeID u) const {
+    return _nets.cbegin() + _headers[u].begin + _headers[u].size;
+  }
+
+  // ! Returns the i-th incident net of hypernode u
+  HyperedgeID get(const HypernodeID u, const HyperedgeID i) const {
+    ASSERT(i < _headers[u].size, V(u) << V(i));
+    return _nets[_headers[u].begin + i];
+  }
+
+  // ! Appends he to I(u). Invalidates the iterators of all hypernodes if the region of u overflows.
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void push_back(const HypernodeID u, const HyperedgeID he) {
+    Header& header = _headers[u];
+    if (header.size == header.capacity) {
+      grow(u, header.size + 1);
+    }
+    _nets[header.begin + header.size++] = he;
+  }
+
+  /*!
+   * Ensures that the region of hypernode u can hold at least min_capacity nets
+   * without being moved. If the region has to be moved, the iterators of all
+   * hypernodes are invalidated.
+   */
+  void reserve(const HypernodeID u, const HyperedgeID min_capacity) {
+    if (_headers[u].capacity < min_capacity) {
+      grow(u, min_capacity);
+    }
+  }
+
+  // ! Removes the i-th incident net of u by swapping it with the last entry.
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void removeAt(const HypernodeID u, const HyperedgeID i) {
+    using std::swap;
+    Header& header = _headers[u];
+    ASSERT(i < header.size, V(u) << V(i));
+    swap(_nets[header.begin + i], _nets[header.begin + header.size - 1]);
+    --header.size;
+  }
+
+  // ! Removes net he from I(u) by swapping it with the last entry.
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void remove(const HypernodeID u, const HyperedgeID he) {
+    using std::swap;
+    Header& header = _headers[u];
+    ASSERT(header.size > 0, V(u));
+    size_t pos = header.begin;
+    const size_t last_entry = header.begin + header.size - 1;
+    while (_nets[pos] != he) {
+      ++pos;
+      ASSERT(pos <= last_entry, "HE" << he << "is not incident to HN" << u);
+    }
+    swap(_nets[pos], _nets[last_entry]);
+    --header.size;
+  }
+
+  // ! Checks whether I(u) of this and I(v) of other contain the same nets.
+  bool isPermutation(const HypernodeID u, const IncidentNetArray& other, const HypernodeID v) const {
+    return size(u) == other.size(v) && std::is_permutation(begin(u), end(u), other.begin(v));
+  }
+
+  size_t numEntries() const {
+    return _nets.size();
+  }
+
+ private:
+  void grow(const HypernodeID u, const HyperedgeID min_capacity) {
+    Header& header = _headers[u];
+    const HyperedgeID new_capacity = std::max(min_capacity,
+                                              std::max(static_cast<HyperedgeID>(2 * header.capacity),
+                                                       kMinSlack));
+    if (header.begin + header.capacity == _nets.size()) {
+      // The region is at the end of the array and can be extended in place.
+      _nets.resize(header.begin + new_capacity);
+    } else if (2 * (_num_abandoned_entries + header.capacity) > _nets.size()) {
+      compact(u, new_capacity);
+      return;
+    } else {
+      const size_t new_begin = _nets.size();
+      _nets.resize(new_begin + new_capacity);
+      std::copy(_nets.begin() + header.begin,
+                _nets.begin() + header.begin + header.size,
+                _nets.begin() + new_begin);
+      _num_abandoned_entries += header.capacity;
+      header.begin = new_begin;
+    }
+    header.capacity = new_capacity;
+  }
+
+  // ! Copies all regions into a new array without gaps, the region of u with new_capacity.
+  void compact(const HypernodeID u, const HyperedgeID new_capacity) {
+    std::vector<HyperedgeID> nets(_nets.size() - _num_abandoned_entries
+                                  - _headers[u].capacity + new_capacity);
+    size_t begin = 0;
+    for (size_t v = 0; v < _headers.size(); ++v) {
+      Header& header = _headers[v];
+      std::copy(_nets.begin() + header.begin,
+                _nets.begin() + header.begin + header.size,
+                nets.begin() + begin);
+      header.begin = begin;
+      if (v == u) {
+        header.capacity = new_capacity;
+      }
+      begin += header.capacity;
+    }
+    ASSERT(begin == nets.size(), V(begin) << V(nets.size()));
+    _nets.swap(nets);
+    _num_abandoned_entries = 0;
+  }
+
+  std::vector<Header> _headers;
+  std::vector<HyperedgeID> _nets;
+  // ! Number of entries in _nets that belong to regions that were moved
+  size_t _num_abandoned_entries;
+};
+
+template <typename HypernodeID, typename HyperedgeID>
+constexpr HyperedgeID IncidentNetArray<HypernodeID, HyperedgeID>::kMinSlack;
+}  // namespace ds
+}  // namespace kahypar
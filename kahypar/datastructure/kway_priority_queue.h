@@ -66,9 +66,12 @@ class KWayPriorityQueue {
 
   ~KWayPriorityQueue() = default;
 
-  // PQ implementation might need different parameters for construction
+  // PQ implementation might need different parameters for construction.
+  // Calling initialize again replaces all queues.
   template <typename ... PQParameters>
   void initialize(PQParameters&& ... parameters) {
+    clear();
+    _queues.clear();
     // k = mapping.size() - 1. Last element in mapping is used as a sentinel.
     for (size_t i = 0; i < _mapping.size() - 1; ++i) {
       _queues.emplace_back(std::forward<PQParameters>(parameters) ...);
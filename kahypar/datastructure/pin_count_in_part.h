@@ -0,0 +1,531 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Dense |E| x k pin counts with entries of type T.
+ *
+ * A hyperedge e fits into entries of type T if |e| < wideMarker(). The pin counts
+ * of the remaining huge hyperedges are stored in a separate array of full-width
+ * entries. Their dense entries contain wideMarker() instead.
+ */
+template <typename T, typename HypernodeID, typename HyperedgeID, typename PartitionID>
+class DensePinCounts {
+ public:
+  static constexpr HypernodeID kInvalidCount = std::numeric_limits<HypernodeID>::max();
+
+  // ! Dense entry of an invalidated hyperedge
+  static constexpr T invalidEntry() {
+    return std::numeric_limits<T>::max();
+  }
+
+  // ! Dense entry of a hyperedge whose pin counts are stored in _wide_pin_counts
+  static constexpr T wideMarker() {
+    return std::numeric_limits<T>::max() - 1;
+  }
+
+  DensePinCounts() :
+    _k(0),
+    _counts(),
+    _wide_edges(),
+    _wide_pin_counts() { }
+
+  DensePinCounts(const DensePinCounts&) = default;
+  DensePinCounts& operator= (const DensePinCounts&) = default;
+
+  DensePinCounts(DensePinCounts&&) = default;
+  DensePinCounts& operator= (DensePinCounts&&) = default;
+
+  ~DensePinCounts() = default;
+
+  // ! Number of hyperedges that do not fit into entries of type T
+  template <typename MaxEdgeSize>
+  static HyperedgeID countWideEdges(const HyperedgeID num_hyperedges,
+                                    const MaxEdgeSize& max_edge_size) {
+    HyperedgeID num_wide_edges = 0;
+    for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+      if (static_cast<size_t>(max_edge_size(he)) >= static_cast<size_t>(wideMarker())) {
+        ++num_wide_edges;
+      }
+    }
+    return num_wide_edges;
+  }
+
+  template <typename MaxEdgeSize>
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k,
+                  const MaxEdgeSize& max_edge_size) {
+    _k = k;
+    _counts.assign(static_cast<size_t>(num_hyperedges) * _k, 0);
+    for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+      if (static_cast<size_t>(max_edge_size(he)) >= static_cast<size_t>(wideMarker())) {
+        std::fill_n(_counts.begin() + static_cast<size_t>(he) * _k, _k, wideMarker());
+        _wide_edges.push_back(he);
+      }
+    }
+    _wide_pin_counts.assign(_wide_edges.size() * _k, 0);
+  }
+
+  void releaseMemory() {
+    _k = 0;
+    std::vector<T>().swap(_counts);
+    std::vector<HyperedgeID>().swap(_wide_edges);
+    std::vector<HypernodeID>().swap(_wide_pin_counts);
+  }
+
+  size_t size() const {
+    return _counts.size();
+  }
+
+  size_t numWideEdges() const {
+    return _wide_edges.size();
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID get(const HyperedgeID he,
+                                                  const PartitionID id) const {
+    const T count = _counts[static_cast<size_t>(he) * _k + id];
+    if (count < wideMarker()) {
+      return count;
+    } else if (count == invalidEntry()) {
+      return kInvalidCount;
+    }
+    return _wide_pin_counts[wideOffset(he) + id];
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID increment(const HyperedgeID he,
+                                                        const PartitionID id) {
+    T& count = _counts[static_cast<size_t>(he) * _k + id];
+    ASSERT(count != invalidEntry(), "Pin counts of HE" << he << "are invalid");
+    if (count < wideMarker()) {
+      // |he| < wideMarker(), therefore the count cannot reach wideMarker().
+      return ++count;
+    }
+    return ++_wide_pin_counts[wideOffset(he) + id];
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID decrement(const HyperedgeID he,
+                                                        const PartitionID id) {
+    T& count = _counts[static_cast<size_t>(he) * _k + id];
+    ASSERT(count != invalidEntry(), "Pin counts of HE" << he << "are invalid");
+    if (count < wideMarker()) {
+      ASSERT(count > 0, "invalid decrease");
+      return --count;
+    }
+    ASSERT(_wide_pin_counts[wideOffset(he) + id] > 0, "invalid decrease");
+    return --_wide_pin_counts[wideOffset(he) + id];
+  }
+
+  void invalidate(const HyperedgeID he) {
+    fill(he, invalidEntry(), kInvalidCount);
+  }
+
+  void reset(const HyperedgeID he) {
+    fill(he, 0, 0);
+  }
+
+  void reset() {
+    for (T& count : _counts) {
+      if (count != wideMarker()) {
+        count = 0;
+      }
+    }
+    std::fill(_wide_pin_counts.begin(), _wide_pin_counts.end(), 0);
+  }
+
+  bool operator== (const DensePinCounts& other) const {
+    return _k == other._k && _counts == other._counts && _wide_edges == other._wide_edges &&
+           _wide_pin_counts == other._wide_pin_counts;
+  }
+
+ private:
+  // ! Position of the first pin count of he in _wide_pin_counts
+  size_t wideOffset(const HyperedgeID he) const {
+    const auto it = std::lower_bound(_wide_edges.cbegin(), _wide_edges.cend(), he);
+    ASSERT(it != _wide_edges.cend() && *it == he, "HE" << he << "has no full-width entries");
+    return static_cast<size_t>(it - _wide_edges.cbegin()) * _k;
+  }
+
+  void fill(const HyperedgeID he, const T value, const HypernodeID wide_value) {
+    const size_t offset = static_cast<size_t>(he) * _k;
+    if (_counts[offset] == wideMarker()) {
+      std::fill_n(_wide_pin_counts.begin() + wideOffset(he), _k, wide_value);
+    } else {
+      std::fill_n(_counts.begin() + offset, _k, value);
+    }
+  }
+
+  PartitionID _k;
+  std::vector<T> _counts;
+  // ! Sorted ids of the hyperedges whose pin counts do not fit into T
+  std::vector<HyperedgeID> _wide_edges;
+  // ! Full-width pin counts of these hyperedges
+  std::vector<HypernodeID> _wide_pin_counts;
+};
+
+/*!
+ * Sparse pin counts: Each hyperedge e owns min(k, |e|) (block, count) entries,
+ * which is enough to store the pin counts of all blocks in its connectivity set.
+ * Looking up a pin count takes O(lambda(e)) time.
+ */
+template <typename HypernodeID, typename HyperedgeID, typename PartitionID>
+class SparsePinCounts {
+ private:
+  struct Entry {
+    PartitionID block;
+    HypernodeID count;
+  };
+
+  // ! Marks a hyperedge whose pin counts are invalid
+  static constexpr PartitionID kInvalidSize = -1;
+
+ public:
+  static constexpr HypernodeID kInvalidCount = std::numeric_limits<HypernodeID>::max();
+
+  SparsePinCounts() :
+    _offsets(),
+    _sizes(),
+    _entries() { }
+
+  SparsePinCounts(const SparsePinCounts&) = default;
+  SparsePinCounts& operator= (const SparsePinCounts&) = default;
+
+  SparsePinCounts(SparsePinCounts&&) = default;
+  SparsePinCounts& operator= (SparsePinCounts&&) = default;
+
+  ~SparsePinCounts() = default;
+
+  template <typename MaxEdgeSize>
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k,
+                  const MaxEdgeSize& max_edge_size) {
+    _offsets.resize(static_cast<size_t>(num_hyperedges) + 1);
+    _offsets[0] = 0;
+    for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+      _offsets[he + 1] = _offsets[he] + std::min(static_cast<size_t>(k),
+                                                 static_cast<size_t>(max_edge_size(he)));
+    }
+    _sizes.assign(num_hyperedges, 0);
+    _entries.assign(_offsets[num_hyperedges], Entry { 0, 0 });
+  }
+
+  void releaseMemory() {
+    std::vector<size_t>().swap(_offsets);
+    std::vector<PartitionID>().swap(_sizes);
+    std::vector<Entry>().swap(_entries);
+  }
+
+  size_t size() const {
+    return _entries.size();
+  }
+
+  size_t numWideEdges() const {
+    return 0;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID get(const HyperedgeID he,
+                                                  const PartitionID id) const {
+    if (_sizes[he] == kInvalidSize) {
+      return kInvalidCount;
+    }
+    const Entry* entry = find(he, id);
+    return entry != nullptr ? entry->count : 0;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID increment(const HyperedgeID he,
+                                                        const PartitionID id) {
+    ASSERT(_sizes[he] != kInvalidSize, "Pin counts of HE" << he << "are invalid");
+    Entry* entry = const_cast<Entry*>(find(he, id));
+    if (entry != nullptr) {
+      return ++entry->count;
+    }
+    ASSERT(_offsets[he] + _sizes[he] < _offsets[he + 1], "No space left for HE" << he);
+    _entries[_offsets[he] + _sizes[he]] = Entry { id, 1 };
+    ++_sizes[he];
+    return 1;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID decrement(const HyperedgeID he,
+                                                        const PartitionID id) {
+    Entry* entry = const_cast<Entry*>(find(he, id));
+    ASSERT(entry != nullptr && entry->count > 0, "invalid decrease");
+    const HypernodeID count = --entry->count;
+    if (count == 0) {
+      --_sizes[he];
+      *entry = _entries[_offsets[he] + _sizes[he]];
+    }
+    return count;
+  }
+
+  void invalidate(const HyperedgeID he) {
+    _sizes[he] = kInvalidSize;
+  }
+
+  void reset(const HyperedgeID he) {
+    _sizes[he] = 0;
+  }
+
+  void reset() {
+    std::fill(_sizes.begin(), _sizes.end(), 0);
+  }
+
+  bool operator== (const SparsePinCounts& other) const {
+    if (_sizes != other._sizes) {
+      return false;
+    }
+    for (size_t he = 0; he < _sizes.size(); ++he) {
+      for (PartitionID i = 0; i < _sizes[he]; ++i) {
+        const Entry& entry = _entries[_offsets[he] + i];
+        if (other.get(he, entry.block) != entry.count) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  const Entry* find(const HyperedgeID he, const PartitionID id) const {
+    const Entry* entry = _entries.data() + _offsets[he];
+    const Entry* const end = entry + _sizes[he];
+    for ( ; entry != end; ++entry) {
+      if (entry->block == id) {
+        return entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // ! Entries of hyperedge e are stored in _entries[_offsets[e], _offsets[e] + _sizes[e])
+  std::vector<size_t> _offsets;
+  std::vector<PartitionID> _sizes;
+  std::vector<Entry> _entries;
+};
+
+/*!
+ * Stores the number of pins of each hyperedge in each block.
+ *
+ * For small k, the pin counts are stored in DensePinCounts. The width of their
+ * entries (8, 16 or 32 bits) is chosen during initialization as the smallest
+ * width that can hold the pin counts of all but at most 1% of the hyperedges.
+ * Since the dense array becomes prohibitively large for large k, the pin counts
+ * are stored in SparsePinCounts if k > kMaxDenseK.
+ *
+ * The layout is only known at runtime. Loops over many pin counts should
+ * therefore resolve it once via visit(), which passes the layout in use to a
+ * generic callable. The accessors of this class resolve it on every call.
+ */
+template <typename HypernodeID, typename HyperedgeID, typename PartitionID>
+class PinCountInPart {
+ private:
+  enum class Layout : uint8_t {
+    dense8,
+    dense16,
+    dense32,
+    sparse
+  };
+
+ public:
+  using Dense8 = DensePinCounts<uint8_t, HypernodeID, HyperedgeID, PartitionID>;
+  using Dense16 = DensePinCounts<uint16_t, HypernodeID, HyperedgeID, PartitionID>;
+  using Dense32 = DensePinCounts<HypernodeID, HypernodeID, HyperedgeID, PartitionID>;
+  using Sparse = SparsePinCounts<HypernodeID, HyperedgeID, PartitionID>;
+
+  static constexpr HypernodeID kInvalidCount = std::numeric_limits<HypernodeID>::max();
+  // ! Largest number of blocks for which pin counts are stored densely
+  static constexpr PartitionID kMaxDenseK = 128;
+  // ! At most 1 / kWideEdgeFraction of all hyperedges use full-width dense entries
+  static constexpr HyperedgeID kWideEdgeFraction = 100;
+
+  PinCountInPart() :
+    _k(0),
+    _layout(Layout::dense32),
+    _dense8(),
+    _dense16(),
+    _dense32(),
+    _sparse() { }
+
+  PinCountInPart(const PinCountInPart&) = default;
+  PinCountInPart& operator= (const PinCountInPart&) = default;
+
+  PinCountInPart(PinCountInPart&&) = default;
+  PinCountInPart& operator= (PinCountInPart&&) = default;
+
+  ~PinCountInPart() = default;
+
+  /*!
+   * Initializes all pin counts to zero.
+   *
+   * \param max_edge_size Callable returning the maximum number of pins of a
+   * hyperedge. It determines the width of dense entries and the space reserved
+   * for sparse pin counts.
+   */
+  template <typename MaxEdgeSize>
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k,
+                  const MaxEdgeSize& max_edge_size) {
+    _k = k;
+    _dense8.releaseMemory();
+    _dense16.releaseMemory();
+    _dense32.releaseMemory();
+    _sparse.releaseMemory();
+
+    const HyperedgeID max_wide_edges = num_hyperedges / kWideEdgeFraction;
+    if (k > kMaxDenseK) {
+      _layout = Layout::sparse;
+      _sparse.initialize(num_hyperedges, k, max_edge_size);
+    } else if (Dense8::countWideEdges(num_hyperedges, max_edge_size) <= max_wide_edges) {
+      _layout = Layout::dense8;
+      _dense8.initialize(num_hyperedges, k, max_edge_size);
+    } else if (Dense16::countWideEdges(num_hyperedges, max_edge_size) <= max_wide_edges) {
+      _layout = Layout::dense16;
+      _dense16.initialize(num_hyperedges, k, max_edge_size);
+    } else {
+      _layout = Layout::dense32;
+      _dense32.initialize(num_hyperedges, k, max_edge_size);
+    }
+  }
+
+  // ! Calls visitor with the pin counts of the layout in use.
+  template <typename Visitor>
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE decltype(auto) visit(Visitor&& visitor) {
+    switch (_layout) {
+      case Layout::dense8: return visitor(_dense8);
+      case Layout::dense16: return visitor(_dense16);
+      case Layout::sparse: return visitor(_sparse);
+      case Layout::dense32: break;
+    }
+    return visitor(_dense32);
+  }
+
+  template <typename Visitor>
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE decltype(auto) visit(Visitor&& visitor) const {
+    switch (_layout) {
+      case Layout::dense8: return visitor(_dense8);
+      case Layout::dense16: return visitor(_dense16);
+      case Layout::sparse: return visitor(_sparse);
+      case Layout::dense32: break;
+    }
+    return visitor(_dense32);
+  }
+
+  bool isSparse() const {
+    return _layout == Layout::sparse;
+  }
+
+  // ! Number of bits of a dense pin count entry (0 if pin counts are stored sparsely)
+  size_t bitsPerEntry() const {
+    switch (_layout) {
+      case Layout::dense8: return 8;
+      case Layout::dense16: return 16;
+      case Layout::dense32: return 8 * sizeof(HypernodeID);
+      case Layout::sparse: return 0;
+    }
+    return 0;
+  }
+
+  // ! Number of hyperedges whose pin counts are stored in full-width entries
+  size_t numWideEdges() const {
+    return visit([](const auto& pin_counts) {
+        return pin_counts.numWideEdges();
+      });
+  }
+
+  // ! Number of stored pin count entries
+  size_t size() const {
+    return visit([](const auto& pin_counts) {
+        return pin_counts.size();
+      });
+  }
+
+  // ! Returns the number of pins of he in block id or kInvalidCount if he was invalidated.
+  HypernodeID get(const HyperedgeID he, const PartitionID id) const {
+    ASSERT(id < _k && id >= 0, V(id));
+    return visit([&](const auto& pin_counts) {
+        return pin_counts.get(he, id);
+      });
+  }
+
+  // ! Increments the number of pins of he in block id and returns the new count.
+  HypernodeID increment(const HyperedgeID he, const PartitionID id) {
+    ASSERT(id < _k && id >= 0, V(id));
+    return visit([&](auto& pin_counts) {
+        return pin_counts.increment(he, id);
+      });
+  }
+
+  // ! Decrements the number of pins of he in block id and returns the new count.
+  HypernodeID decrement(const HyperedgeID he, const PartitionID id) {
+    ASSERT(id < _k && id >= 0, V(id));
+    return visit([&](auto& pin_counts) {
+        return pin_counts.decrement(he, id);
+      });
+  }
+
+  // ! Sets the pin counts of he to kInvalidCount.
+  void invalidate(const HyperedgeID he) {
+    visit([&](auto& pin_counts) {
+        pin_counts.invalidate(he);
+      });
+  }
+
+  // ! Sets the pin counts of he to zero.
+  void reset(const HyperedgeID he) {
+    visit([&](auto& pin_counts) {
+        pin_counts.reset(he);
+      });
+  }
+
+  // ! Sets the pin counts of all hyperedges to zero.
+  void reset() {
+    visit([](auto& pin_counts) {
+        pin_counts.reset();
+      });
+  }
+
+  bool operator== (const PinCountInPart& other) const {
+    return _k == other._k && _layout == other._layout &&
+           _dense8 == other._dense8 && _dense16 == other._dense16 &&
+           _dense32 == other._dense32 && _sparse == other._sparse;
+  }
+
+  bool operator!= (const PinCountInPart& other) const {
+    return !operator== (other);
+  }
+
+ private:
+  PartitionID _k;
+  Layout _layout;
+  // ! Only the pin counts matching _layout are used.
+  Dense8 _dense8;
+  Dense16 _dense16;
+  Dense32 _dense32;
+  Sparse _sparse;
+};
+}  // namespace ds
+}  // namespace kahypar
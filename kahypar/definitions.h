@@ -26,14 +26,20 @@
 
 #include "datastructure/hypergraph.h"
 
-// Use bucket PQ for FM refinement.
-// #define USE_BUCKET_QUEUE
-
 namespace kahypar {
+// Enable the CMake option KAHYPAR_USE_64_BIT_IDS to partition hypergraphs with more
+// than 2^32 pins or with node/edge weights that do not fit into 32 bits.
+#ifdef KAHYPAR_USE_64_BIT_IDS
+using HypernodeID = uint64_t;
+using HyperedgeID = uint64_t;
+using HypernodeWeight = int64_t;
+using HyperedgeWeight = int64_t;
+#else
 using HypernodeID = uint32_t;
 using HyperedgeID = uint32_t;
 using HypernodeWeight = int32_t;
 using HyperedgeWeight = int32_t;
+#endif
 using PartitionID = int32_t;
 using Gain = HyperedgeWeight;
 
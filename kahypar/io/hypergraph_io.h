@@ -20,16 +20,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/memory_mapped_file.h"
+#include "kahypar/utils/parallel.h"
 
 namespace kahypar {
 namespace io {
@@ -136,55 +141,667 @@ static inline void readHypergraphFile(const std::string& filename, HypernodeID&
   }
 }
 
+namespace internal {
+static inline bool isSpace(const char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline bool isDigit(const char c) {
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+static inline const char* skipSpaces(const char* pos, const char* end) {
+  while (pos != end && isSpace(*pos)) {
+    ++pos;
+  }
+  return pos;
+}
+
+// ! Returns the position of the '\n' terminating the line that contains pos
+// ! (or end, if the line is not terminated).
+static inline const char* lineEnd(const char* pos, const char* end) {
+  const char* newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+  return newline != nullptr ? newline : end;
+}
+
+// ! Returns the beginning of the line following the line that ends at line_end.
+static inline const char* nextLine(const char* line_end, const char* end) {
+  return line_end == end ? end : line_end + 1;
+}
+
+static inline bool isComment(const char* line_begin, const char* line_end) {
+  return line_begin != line_end && *line_begin == '%';
+}
+
+// ! Comments and blank lines do not contribute to the hypergraph.
+static inline bool isSkipped(const char* line_begin, const char* line_end) {
+  return isComment(line_begin, line_end) || skipSpaces(line_begin, line_end) == line_end;
+}
+
+// ! Parses the integer starting at pos and advances pos to the first character
+// ! after the integer. pos has to point to the first character of the token.
+template <typename T>
+static inline T parseInteger(const char*& pos, const char* end) {
+  bool negative = false;
+  if (std::is_signed<T>::value && pos != end && *pos == '-') {
+    negative = true;
+    ++pos;
+  }
+  if (pos == end || !isDigit(*pos)) {
+    std::cerr << "Error: Invalid character '" << (pos == end ? ' ' : *pos)
+              << "' in hypergraph file" << std::endl;
+    exit(1);
+  }
+  T value = 0;
+  while (pos != end && isDigit(*pos)) {
+    value = 10 * value + static_cast<T>(*pos - '0');
+    ++pos;
+  }
+  return negative ? static_cast<T>(0 - value) : value;
+}
+
+static inline size_t countTokens(const char* pos, const char* end) {
+  size_t num_tokens = 0;
+  while ((pos = skipSpaces(pos, end)) != end) {
+    ++num_tokens;
+    while (pos != end && !isSpace(*pos)) {
+      ++pos;
+    }
+  }
+  return num_tokens;
+}
+}  // namespace internal
+
+/*!
+ * Parser for hypergraph files in hMetis format that operates directly on
+ * the memory mapped file.
+ *
+ * The parser works in three passes over the file. The body of the file
+ * (everything after the header line) is split into chunks at line boundaries.
+ * The first two passes count the lines and pins of each chunk, which determines
+ * at which hyperedge and pin offset each chunk starts. This allows the caller to
+ * allocate the output arrays with their final size before the third pass
+ * parses all chunks into these arrays. All passes process the chunks in parallel.
+ */
+class HypergraphFileParser {
+  struct Chunk {
+    const char* begin;
+    const char* end;
+    size_t first_line;
+    size_t num_lines;
+    size_t first_pin;
+    size_t num_pins;
+  };
+
+  // Files smaller than this are parsed by a single thread.
+  static constexpr size_t kMinChunkSize = 1 << 22;
+
+ public:
+  HypergraphFileParser(const std::string& filename, const size_t num_threads,
+                       const size_t min_chunk_size = kMinChunkSize) :
+    _file(filename),
+    _num_hypernodes(0),
+    _num_hyperedges(0),
+    _num_pins(0),
+    _num_lines(0),
+    _type(HypergraphType::Unweighted),
+    _chunks() {
+    ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+    if (!_file.isOpen()) {
+      std::cerr << "Error: File not found: " << filename << std::endl;
+      exit(1);
+    }
+    const char* body = parseHeader();
+    createChunks(body, num_threads, std::max(min_chunk_size, static_cast<size_t>(1)));
+    countLines();
+    countPins();
+  }
+
+  HypergraphFileParser(const HypergraphFileParser&) = delete;
+  HypergraphFileParser& operator= (const HypergraphFileParser&) = delete;
+
+  HypergraphFileParser(HypergraphFileParser&&) = delete;
+  HypergraphFileParser& operator= (HypergraphFileParser&&) = delete;
+
+  HypernodeID numHypernodes() const {
+    return _num_hypernodes;
+  }
+
+  HyperedgeID numHyperedges() const {
+    return _num_hyperedges;
+  }
+
+  size_t numPins() const {
+    return _num_pins;
+  }
+
+  bool hasHyperedgeWeights() const {
+    return _type == HypergraphType::EdgeWeights ||
+           _type == HypergraphType::EdgeAndNodeWeights;
+  }
+
+  bool hasHypernodeWeights() const {
+    return _type == HypergraphType::NodeWeights ||
+           _type == HypergraphType::EdgeAndNodeWeights;
+  }
+
+  /*!
+   * Parses the hypergraph into the given arrays:
+   * index_vector needs space for numHyperedges() + 1 entries and edge_vector
+   * for numPins() entries. If the file contains weights, hyperedge_weights and
+   * hypernode_weights need space for numHyperedges() and numHypernodes() entries.
+   * Weights are skipped, if the corresponding array is a nullptr.
+   */
+  void parse(size_t* index_vector, HypernodeID* edge_vector,
+             HyperedgeWeight* hyperedge_weights, HypernodeWeight* hypernode_weights) const {
+    if (hypernode_weights != nullptr && hasHypernodeWeights() &&
+        _num_lines < static_cast<size_t>(_num_hyperedges) + _num_hypernodes) {
+      std::cerr << "Error: File contains " << _num_lines - _num_hyperedges << " of "
+                << _num_hypernodes << " hypernode weights" << std::endl;
+      exit(1);
+    }
+    const bool parse_hyperedge_weights = hyperedge_weights != nullptr && hasHyperedgeWeights();
+    const bool parse_hypernode_weights = hypernode_weights != nullptr && hasHypernodeWeights();
+    const size_t num_hyperedges = _num_hyperedges;
+    const size_t num_weighted_lines = num_hyperedges + _num_hypernodes;
+
+    parallel::executeConcurrent(_chunks.size(), [&](const size_t chunk_id) {
+        const Chunk& chunk = _chunks[chunk_id];
+        size_t line = chunk.first_line;
+        size_t pin_offset = chunk.first_pin;
+        for (const char* pos = chunk.begin; pos < chunk.end && line < num_weighted_lines; ) {
+          const char* line_end = internal::lineEnd(pos, chunk.end);
+          if (!internal::isSkipped(pos, line_end)) {
+            pos = internal::skipSpaces(pos, line_end);
+            if (line < num_hyperedges) {
+              index_vector[line] = pin_offset;
+              if (hasHyperedgeWeights()) {
+                const HyperedgeWeight weight = internal::parseInteger<HyperedgeWeight>(pos, line_end);
+                if (parse_hyperedge_weights) {
+                  hyperedge_weights[line] = weight;
+                }
+                pos = internal::skipSpaces(pos, line_end);
+              }
+              while (pos != line_end) {
+                const HypernodeID pin = internal::parseInteger<HypernodeID>(pos, line_end);
+                if (pin == 0 || pin > _num_hypernodes) {
+                  std::cerr << "Error: Hyperedge " << line << " contains invalid hypernode ID "
+                            << pin << std::endl;
+                  exit(1);
+                }
+                // Hypernode IDs start from 0
+                edge_vector[pin_offset++] = pin - 1;
+                pos = internal::skipSpaces(pos, line_end);
+              }
+            } else if (parse_hypernode_weights) {
+              hypernode_weights[line - num_hyperedges] =
+                internal::parseInteger<HypernodeWeight>(pos, line_end);
+            }
+            ++line;
+          }
+          pos = internal::nextLine(line_end, chunk.end);
+        }
+      });
+    index_vector[num_hyperedges] = _num_pins;
+  }
+
+ private:
+  // Parses the header line and returns the beginning of the first line after it.
+  const char* parseHeader() {
+    const char* pos = _file.data();
+    const char* end = pos + _file.size();
+    const char* line_end = internal::lineEnd(pos, end);
+    // skip any comments
+    while (pos < end && internal::isSkipped(pos, line_end)) {
+      pos = internal::nextLine(line_end, end);
+      line_end = internal::lineEnd(pos, end);
+    }
+    if (pos >= end) {
+      std::cerr << "Error: Hypergraph file does not contain a header" << std::endl;
+      exit(1);
+    }
+    pos = internal::skipSpaces(pos, line_end);
+    _num_hyperedges = internal::parseInteger<HyperedgeID>(pos, line_end);
+    pos = internal::skipSpaces(pos, line_end);
+    _num_hypernodes = internal::parseInteger<HypernodeID>(pos, line_end);
+    pos = internal::skipSpaces(pos, line_end);
+    if (pos != line_end) {
+      _type = static_cast<HypergraphType>(internal::parseInteger<int>(pos, line_end));
+    }
+    ASSERT(_type == HypergraphType::Unweighted ||
+           _type == HypergraphType::EdgeWeights ||
+           _type == HypergraphType::NodeWeights ||
+           _type == HypergraphType::EdgeAndNodeWeights,
+           "Hypergraph in file has wrong type");
+    return internal::nextLine(line_end, end);
+  }
+
+  void createChunks(const char* body, const size_t num_threads, const size_t min_chunk_size) {
+    const char* end = _file.data() + _file.size();
+    const size_t body_size = end - body;
+    const size_t num_chunks = std::max(std::min(num_threads, body_size / min_chunk_size),
+                                       static_cast<size_t>(1));
+    const char* chunk_begin = body;
+    for (size_t i = 1; i <= num_chunks; ++i) {
+      const char* chunk_end = end;
+      if (i < num_chunks) {
+        // Chunks always end after a complete line.
+        chunk_end = std::max(chunk_begin, body + i * (body_size / num_chunks));
+        chunk_end = internal::nextLine(internal::lineEnd(chunk_end, end), end);
+      }
+      _chunks.push_back(Chunk { chunk_begin, chunk_end, 0, 0, 0, 0 });
+      chunk_begin = chunk_end;
+    }
+  }
+
+  // First pass: Count the number of (non-comment) lines of each chunk.
+  void countLines() {
+    parallel::executeConcurrent(_chunks.size(), [&](const size_t chunk_id) {
+        Chunk& chunk = _chunks[chunk_id];
+        for (const char* pos = chunk.begin; pos < chunk.end; ) {
+          const char* line_end = internal::lineEnd(pos, chunk.end);
+          if (!internal::isSkipped(pos, line_end)) {
+            ++chunk.num_lines;
+          }
+          pos = internal::nextLine(line_end, chunk.end);
+        }
+      });
+    for (Chunk& chunk : _chunks) {
+      chunk.first_line = _num_lines;
+      _num_lines += chunk.num_lines;
+    }
+    if (_num_lines < _num_hyperedges) {
+      std::cerr << "Error: File contains " << _num_lines << " of "
+                << _num_hyperedges << " hyperedges" << std::endl;
+      exit(1);
+    }
+  }
+
+  // Second pass: Count the number of pins of each chunk.
+  void countPins() {
+    const size_t num_hyperedges = _num_hyperedges;
+    const size_t num_weight_tokens = hasHyperedgeWeights() ? 1 : 0;
+    parallel::executeConcurrent(_chunks.size(), [&](const size_t chunk_id) {
+        Chunk& chunk = _chunks[chunk_id];
+        size_t line = chunk.first_line;
+        for (const char* pos = chunk.begin; pos < chunk.end && line < num_hyperedges; ) {
+          const char* line_end = internal::lineEnd(pos, chunk.end);
+          if (!internal::isSkipped(pos, line_end)) {
+            const size_t num_tokens = internal::countTokens(pos, line_end);
+            if (num_tokens == num_weight_tokens) {
+              std::cerr << "Error: Hyperedge " << line << " is empty" << std::endl;
+              exit(1);
+            }
+            chunk.num_pins += num_tokens - std::min(num_tokens, num_weight_tokens);
+            ++line;
+          }
+          pos = internal::nextLine(line_end, chunk.end);
+        }
+      });
+    for (Chunk& chunk : _chunks) {
+      chunk.first_pin = _num_pins;
+      _num_pins += chunk.num_pins;
+    }
+  }
+
+  MemoryMappedFile _file;
+  HypernodeID _num_hypernodes;
+  HyperedgeID _num_hyperedges;
+  size_t _num_pins;
+  size_t _num_lines;
+  HypergraphType _type;
+  std::vector<Chunk> _chunks;
+};
+
+/*!
+ * Reads a hypergraph file in hMetis format using the memory mapped HypergraphFileParser.
+ * The output vectors are sized exactly once. The result is identical to the one of
+ * readHypergraphFile. The file is parsed sequentially, unless the caller opts in to
+ * parallel parsing by passing num_threads (e.g., context.shared_memory.num_threads).
+ */
+static inline void readHypergraphFileMapped(const std::string& filename,
+                                            HypernodeID& num_hypernodes,
+                                            HyperedgeID& num_hyperedges,
+                                            HyperedgeIndexVector& index_vector,
+                                            HyperedgeVector& edge_vector,
+                                            HyperedgeWeightVector* hyperedge_weights = nullptr,
+                                            HypernodeWeightVector* hypernode_weights = nullptr,
+                                            const size_t num_threads = 1) {
+  ASSERT(index_vector.empty() && edge_vector.empty());
+  const HypergraphFileParser parser(filename, num_threads);
+  num_hypernodes = parser.numHypernodes();
+  num_hyperedges = parser.numHyperedges();
+
+  index_vector.resize(static_cast<size_t>(num_hyperedges) +  /*sentinel*/ 1);
+  edge_vector.resize(parser.numPins());
+  HyperedgeWeight* hyperedge_weights_ptr = nullptr;
+  HypernodeWeight* hypernode_weights_ptr = nullptr;
+  if (parser.hasHyperedgeWeights()) {
+    if (hyperedge_weights == nullptr) {
+      LOG << "****** ignoring hyperedge weights ******";
+    } else {
+      hyperedge_weights->resize(num_hyperedges);
+      hyperedge_weights_ptr = hyperedge_weights->data();
+    }
+  }
+  if (parser.hasHypernodeWeights()) {
+    if (hypernode_weights == nullptr) {
+      LOG << " ****** ignoring hypernode weights ******";
+    } else {
+      hypernode_weights->resize(num_hypernodes);
+      hypernode_weights_ptr = hypernode_weights->data();
+    }
+  }
+  parser.parse(index_vector.data(), edge_vector.data(),
+               hyperedge_weights_ptr, hypernode_weights_ptr);
+}
+
+/*!
+ * Binary hypergraph format:
+ * The file starts with a BinaryHypergraphHeader, which is followed by the
+ * index_vector (num_hyperedges + 1 entries), the edge_vector (num_pins entries)
+ * and the optional hyperedge and hypernode weight arrays. Each array starts at
+ * an offset that is a multiple of kBinaryHypergraphAlignment. All data is stored
+ * in little-endian byte order. The arrays can therefore be used directly from
+ * a memory mapping of the file.
+ */
+static constexpr char kBinaryHypergraphMagic[8] = { 'K', 'a', 'H', 'y', 'P', 'a', 'r', 'B' };
+static constexpr uint32_t kBinaryHypergraphVersion = 1;
+static constexpr size_t kBinaryHypergraphAlignment = 64;
+
+struct BinaryHypergraphHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t type;
+  uint64_t num_hypernodes;
+  uint64_t num_hyperedges;
+  uint64_t num_pins;
+  // Sizes of the stored types in bytes. A file can only be loaded by
+  // a build that uses the same types.
+  uint8_t index_bytes;
+  uint8_t hypernode_id_bytes;
+  uint8_t hyperedge_weight_bytes;
+  uint8_t hypernode_weight_bytes;
+  uint8_t reserved[20];
+};
+static_assert(sizeof(BinaryHypergraphHeader) == kBinaryHypergraphAlignment,
+              "Binary header has to be padded to the alignment of the arrays");
+
+namespace internal {
+static inline bool isLittleEndian() {
+  const uint16_t probe = 1;
+  return *reinterpret_cast<const uint8_t*>(&probe) == 1;
+}
+
+static inline size_t alignedOffset(const size_t offset) {
+  return (offset + kBinaryHypergraphAlignment - 1) / kBinaryHypergraphAlignment
+         * kBinaryHypergraphAlignment;
+}
+
+static inline bool hasHyperedgeWeights(const HypergraphType type) {
+  return type == HypergraphType::EdgeWeights || type == HypergraphType::EdgeAndNodeWeights;
+}
+
+static inline bool hasHypernodeWeights(const HypergraphType type) {
+  return type == HypergraphType::NodeWeights || type == HypergraphType::EdgeAndNodeWeights;
+}
+
+// ! Offsets of the arrays following the header of a binary hypergraph file.
+struct BinaryHypergraphLayout {
+  explicit BinaryHypergraphLayout(const BinaryHypergraphHeader& header) :
+    index_vector(sizeof(BinaryHypergraphHeader)),
+    edge_vector(alignedOffset(index_vector + (header.num_hyperedges + 1) * sizeof(size_t))),
+    hyperedge_weights(alignedOffset(edge_vector + header.num_pins * sizeof(HypernodeID))),
+    hypernode_weights(),
+    file_size() {
+    const HypergraphType type = static_cast<HypergraphType>(header.type);
+    size_t end = edge_vector + header.num_pins * sizeof(HypernodeID);
+    if (hasHyperedgeWeights(type)) {
+      end = hyperedge_weights + header.num_hyperedges * sizeof(HyperedgeWeight);
+    }
+    hypernode_weights = alignedOffset(end);
+    if (hasHypernodeWeights(type)) {
+      end = hypernode_weights + header.num_hypernodes * sizeof(HypernodeWeight);
+    }
+    file_size = end;
+  }
+
+  size_t index_vector;
+  size_t edge_vector;
+  size_t hyperedge_weights;
+  size_t hypernode_weights;
+  size_t file_size;
+};
+}  // namespace internal
+
+static inline bool isBinaryHypergraphFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  char magic[sizeof(kBinaryHypergraphMagic)];
+  return file.read(magic, sizeof(magic)) &&
+         std::memcmp(magic, kBinaryHypergraphMagic, sizeof(magic)) == 0;
+}
+
+/*!
+ * Read-only view of a memory mapped binary hypergraph file. The accessors
+ * return pointers into the mapping that can be passed to the Hypergraph
+ * constructor as they are.
+ */
+class BinaryHypergraphFile {
+ public:
+  explicit BinaryHypergraphFile(const std::string& filename) :
+    _file(filename),
+    _header() {
+    ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+    if (!_file.isOpen()) {
+      std::cerr << "Error: File not found: " << filename << std::endl;
+      exit(1);
+    }
+    if (_file.size() < sizeof(BinaryHypergraphHeader)) {
+      std::cerr << "Error: " << filename << " is not a binary hypergraph file" << std::endl;
+      exit(1);
+    }
+    std::memcpy(&_header, _file.data(), sizeof(BinaryHypergraphHeader));
+    if (std::memcmp(_header.magic, kBinaryHypergraphMagic, sizeof(kBinaryHypergraphMagic)) != 0) {
+      std::cerr << "Error: " << filename << " is not a binary hypergraph file" << std::endl;
+      exit(1);
+    }
+    if (_header.version != kBinaryHypergraphVersion) {
+      std::cerr << "Error: Unsupported binary hypergraph format version "
+                << _header.version << std::endl;
+      exit(1);
+    }
+    if (!internal::isLittleEndian() ||
+        _header.index_bytes != sizeof(size_t) ||
+        _header.hypernode_id_bytes != sizeof(HypernodeID) ||
+        _header.hyperedge_weight_bytes != sizeof(HyperedgeWeight) ||
+        _header.hypernode_weight_bytes != sizeof(HypernodeWeight)) {
+      std::cerr << "Error: Binary hypergraph file " << filename
+                << " was written by an incompatible build" << std::endl;
+      exit(1);
+    }
+    if (_file.size() < internal::BinaryHypergraphLayout(_header).file_size) {
+      std::cerr << "Error: Binary hypergraph file " << filename << " is truncated" << std::endl;
+      exit(1);
+    }
+    validateIncidenceArrays(filename);
+  }
+
+  BinaryHypergraphFile(const BinaryHypergraphFile&) = delete;
+  BinaryHypergraphFile& operator= (const BinaryHypergraphFile&) = delete;
+
+  BinaryHypergraphFile(BinaryHypergraphFile&&) = delete;
+  BinaryHypergraphFile& operator= (BinaryHypergraphFile&&) = delete;
+
+  HypernodeID numHypernodes() const {
+    return _header.num_hypernodes;
+  }
+
+  HyperedgeID numHyperedges() const {
+    return _header.num_hyperedges;
+  }
+
+  size_t numPins() const {
+    return _header.num_pins;
+  }
+
+  HypergraphType type() const {
+    return static_cast<HypergraphType>(_header.type);
+  }
+
+  const size_t* indexVector() const {
+    return array<size_t>(internal::BinaryHypergraphLayout(_header).index_vector);
+  }
+
+  const HypernodeID* edgeVector() const {
+    return array<HypernodeID>(internal::BinaryHypergraphLayout(_header).edge_vector);
+  }
+
+  // ! Returns nullptr if the file does not contain hyperedge weights.
+  const HyperedgeWeight* hyperedgeWeights() const {
+    return internal::hasHyperedgeWeights(type()) ?
+           array<HyperedgeWeight>(internal::BinaryHypergraphLayout(_header).hyperedge_weights) :
+           nullptr;
+  }
+
+  // ! Returns nullptr if the file does not contain hypernode weights.
+  const HypernodeWeight* hypernodeWeights() const {
+    return internal::hasHypernodeWeights(type()) ?
+           array<HypernodeWeight>(internal::BinaryHypergraphLayout(_header).hypernode_weights) :
+           nullptr;
+  }
+
+ private:
+  // The arrays are passed to the Hypergraph constructor as they are. Thus, the
+  // hyperedge indices have to be monotone and all pins have to be valid hypernodes.
+  void validateIncidenceArrays(const std::string& filename) const {
+    const size_t* index_vector = indexVector();
+    const HypernodeID* edge_vector = edgeVector();
+    if (index_vector[0] != 0 || index_vector[numHyperedges()] != numPins()) {
+      std::cerr << "Error: Binary hypergraph file " << filename
+                << " contains invalid hyperedge indices" << std::endl;
+      exit(1);
+    }
+    for (HyperedgeID he = 0; he < numHyperedges(); ++he) {
+      if (index_vector[he] > index_vector[he + 1]) {
+        std::cerr << "Error: Binary hypergraph file " << filename
+                  << " contains non-monotone hyperedge indices" << std::endl;
+        exit(1);
+      }
+    }
+    for (size_t i = 0; i < numPins(); ++i) {
+      if (edge_vector[i] >= numHypernodes()) {
+        std::cerr << "Error: Binary hypergraph file " << filename
+                  << " contains invalid hypernode ID " << edge_vector[i] << std::endl;
+        exit(1);
+      }
+    }
+  }
+
+  template <typename T>
+  const T* array(const size_t offset) const {
+    return reinterpret_cast<const T*>(_file.data() + offset);
+  }
+
+  MemoryMappedFile _file;
+  BinaryHypergraphHeader _header;
+};
+
+static inline Hypergraph createHypergraphFromBinaryFile(const std::string& filename,
+                                                        const PartitionID num_parts) {
+  const BinaryHypergraphFile file(filename);
+  Hypergraph hypergraph(file.numHypernodes(), file.numHyperedges(), file.indexVector(),
+                        file.edgeVector(), num_parts, file.hyperedgeWeights(),
+                        file.hypernodeWeights());
+  return hypergraph;
+}
+
+static inline void readBinaryHypergraphFile(const std::string& filename,
+                                            HypernodeID& num_hypernodes,
+                                            HyperedgeID& num_hyperedges,
+                                            std::unique_ptr<size_t[]>& index_vector,
+                                            std::unique_ptr<HypernodeID[]>& edge_vector,
+                                            std::unique_ptr<HyperedgeWeight[]>& hyperedge_weights,
+                                            std::unique_ptr<HypernodeWeight[]>& hypernode_weights) {
+  const BinaryHypergraphFile file(filename);
+  num_hypernodes = file.numHypernodes();
+  num_hyperedges = file.numHyperedges();
+
+  ASSERT(index_vector == nullptr);
+  ASSERT(edge_vector == nullptr);
+  index_vector.reset(new size_t[static_cast<size_t>(num_hyperedges) +  /*sentinel*/ 1]);
+  std::memcpy(index_vector.get(), file.indexVector(),
+              (static_cast<size_t>(num_hyperedges) + 1) * sizeof(size_t));
+  edge_vector.reset(new HypernodeID[file.numPins()]);
+  std::memcpy(edge_vector.get(), file.edgeVector(), file.numPins() * sizeof(HypernodeID));
+
+  if (file.hyperedgeWeights() != nullptr) {
+    ASSERT(hyperedge_weights == nullptr);
+    hyperedge_weights.reset(new HyperedgeWeight[num_hyperedges]);
+    std::memcpy(hyperedge_weights.get(), file.hyperedgeWeights(),
+                num_hyperedges * sizeof(HyperedgeWeight));
+  }
+
+  if (file.hypernodeWeights() != nullptr) {
+    ASSERT(hypernode_weights == nullptr);
+    hypernode_weights.reset(new HypernodeWeight[num_hypernodes]);
+    std::memcpy(hypernode_weights.get(), file.hypernodeWeights(),
+                num_hypernodes * sizeof(HypernodeWeight));
+  }
+}
+
 static inline void readHypergraphFile(const std::string& filename,
                                       HypernodeID& num_hypernodes,
                                       HyperedgeID& num_hyperedges,
                                       std::unique_ptr<size_t[]>& index_vector,
                                       std::unique_ptr<HypernodeID[]>& edge_vector,
                                       std::unique_ptr<HyperedgeWeight[]>& hyperedge_weights,
-                                      std::unique_ptr<HypernodeWeight[]>& hypernode_weights) {
-  HyperedgeIndexVector index_vec;
-  HyperedgeVector edge_vec;
-  HyperedgeWeightVector edge_weights_vec;
-  HypernodeWeightVector node_weights_vec;
-
-  readHypergraphFile(filename, num_hypernodes, num_hyperedges, index_vec,
-                     edge_vec, &edge_weights_vec, &node_weights_vec);
+                                      std::unique_ptr<HypernodeWeight[]>& hypernode_weights,
+                                      const size_t num_threads = 1) {
+  if (isBinaryHypergraphFile(filename)) {
+    readBinaryHypergraphFile(filename, num_hypernodes, num_hyperedges, index_vector,
+                             edge_vector, hyperedge_weights, hypernode_weights);
+    return;
+  }
+  const HypergraphFileParser parser(filename, num_threads);
+  num_hypernodes = parser.numHypernodes();
+  num_hyperedges = parser.numHyperedges();
 
+  // The arrays are parsed into directly and therefore do not need to be initialized.
   ASSERT(index_vector == nullptr);
   ASSERT(edge_vector == nullptr);
-  index_vector = std::make_unique<size_t[]>(index_vec.size());
-  edge_vector = std::make_unique<HypernodeID[]>(edge_vec.size());
-
-  memcpy(index_vector.get(), index_vec.data(), index_vec.size() * sizeof(size_t));
-  memcpy(edge_vector.get(), edge_vec.data(), edge_vec.size() * sizeof(HypernodeID));
+  index_vector.reset(new size_t[static_cast<size_t>(num_hyperedges) +  /*sentinel*/ 1]);
+  edge_vector.reset(new HypernodeID[parser.numPins()]);
 
-  if (!edge_weights_vec.empty()) {
+  if (parser.hasHyperedgeWeights()) {
     ASSERT(hyperedge_weights == nullptr);
-    hyperedge_weights = std::make_unique<HyperedgeWeight[]>(edge_weights_vec.size());
-    memcpy(hyperedge_weights.get(), edge_weights_vec.data(),
-           edge_weights_vec.size() * sizeof(HyperedgeWeight));
+    hyperedge_weights.reset(new HyperedgeWeight[num_hyperedges]);
   }
 
-  if (!node_weights_vec.empty()) {
+  if (parser.hasHypernodeWeights()) {
     ASSERT(hypernode_weights == nullptr);
-    hypernode_weights = std::make_unique<HypernodeWeight[]>(node_weights_vec.size());
-    memcpy(hypernode_weights.get(), node_weights_vec.data(),
-           node_weights_vec.size() * sizeof(HypernodeWeight));
+    hypernode_weights.reset(new HypernodeWeight[num_hypernodes]);
   }
+
+  parser.parse(index_vector.get(), edge_vector.get(),
+               hyperedge_weights.get(), hypernode_weights.get());
 }
 
 
 static inline Hypergraph createHypergraphFromFile(const std::string& filename,
-                                                  const PartitionID num_parts) {
+                                                  const PartitionID num_parts,
+                                                  const size_t num_threads = 1) {
+  if (isBinaryHypergraphFile(filename)) {
+    return createHypergraphFromBinaryFile(filename, num_parts);
+  }
   HypernodeID num_hypernodes;
   HyperedgeID num_hyperedges;
   HyperedgeIndexVector index_vector;
   HyperedgeVector edge_vector;
   HypernodeWeightVector hypernode_weights;
   HyperedgeWeightVector hyperedge_weights;
-  readHypergraphFile(filename, num_hypernodes, num_hyperedges,
-                     index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
+  readHypergraphFileMapped(filename, num_hypernodes, num_hyperedges,
+                           index_vector, edge_vector, &hyperedge_weights, &hypernode_weights,
+                           num_threads);
   return Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
                     num_parts, &hyperedge_weights, &hypernode_weights);
 }
@@ -230,6 +847,83 @@ static inline void writeHypergraphFile(const Hypergraph& hypergraph, const std::
 }
 
 
+namespace internal {
+template <typename T>
+static inline void writeBinaryArray(std::ofstream& out_stream, const std::vector<T>& array) {
+  const size_t padding = alignedOffset(static_cast<size_t>(out_stream.tellp())) -
+                         static_cast<size_t>(out_stream.tellp());
+  const char zeros[kBinaryHypergraphAlignment] = { };
+  out_stream.write(zeros, padding);
+  out_stream.write(reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T));
+}
+}  // namespace internal
+
+/*!
+ * Writes the hypergraph in the binary hypergraph format
+ * (see BinaryHypergraphHeader) that can be loaded via createHypergraphFromBinaryFile.
+ * Returns false, if the file could not be written.
+ */
+static inline bool writeHypergraphBinaryFile(const Hypergraph& hypergraph,
+                                             const std::string& filename) {
+  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+  ALWAYS_ASSERT(!hypergraph.isModified(), "Hypergraph is modified. Reindexing HNs/HEs necessary.");
+  ALWAYS_ASSERT(internal::isLittleEndian(), "Binary hypergraph files are little-endian");
+
+  BinaryHypergraphHeader header = { };
+  std::memcpy(header.magic, kBinaryHypergraphMagic, sizeof(kBinaryHypergraphMagic));
+  header.version = kBinaryHypergraphVersion;
+  header.type = static_cast<uint32_t>(hypergraph.type());
+  header.num_hypernodes = hypergraph.initialNumNodes();
+  header.num_hyperedges = hypergraph.initialNumEdges();
+  header.num_pins = hypergraph.initialNumPins();
+  header.index_bytes = sizeof(size_t);
+  header.hypernode_id_bytes = sizeof(HypernodeID);
+  header.hyperedge_weight_bytes = sizeof(HyperedgeWeight);
+  header.hypernode_weight_bytes = sizeof(HypernodeWeight);
+
+  std::vector<size_t> index_vector;
+  HyperedgeVector edge_vector;
+  index_vector.reserve(static_cast<size_t>(hypergraph.initialNumEdges()) + 1);
+  edge_vector.reserve(hypergraph.initialNumPins());
+  index_vector.push_back(0);
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      edge_vector.push_back(pin);
+    }
+    index_vector.push_back(edge_vector.size());
+  }
+
+  std::ofstream out_stream(filename.c_str(), std::ios::binary);
+  out_stream.write(reinterpret_cast<const char*>(&header), sizeof(BinaryHypergraphHeader));
+  internal::writeBinaryArray(out_stream, index_vector);
+  internal::writeBinaryArray(out_stream, edge_vector);
+
+  if (internal::hasHyperedgeWeights(hypergraph.type())) {
+    HyperedgeWeightVector hyperedge_weights;
+    hyperedge_weights.reserve(hypergraph.initialNumEdges());
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      hyperedge_weights.push_back(hypergraph.edgeWeight(he));
+    }
+    internal::writeBinaryArray(out_stream, hyperedge_weights);
+  }
+
+  if (internal::hasHypernodeWeights(hypergraph.type())) {
+    HypernodeWeightVector hypernode_weights;
+    hypernode_weights.reserve(hypergraph.initialNumNodes());
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypernode_weights.push_back(hypergraph.nodeWeight(hn));
+    }
+    internal::writeBinaryArray(out_stream, hypernode_weights);
+  }
+  out_stream.close();
+  if (!out_stream.good()) {
+    std::cerr << "Error: Could not write binary hypergraph file " << filename << std::endl;
+    return false;
+  }
+  return true;
+}
+
+
 static inline void writeHypergraphToGraphMLFile(const Hypergraph& hypergraph,
                                                 const std::string& filename,
                                                 const std::vector<PartitionID>* hn_cluster_ids = nullptr,
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace kahypar {
+namespace io {
+/*!
+ * Read-only view of the contents of a file.
+ * On POSIX systems, the file is mapped into memory. Otherwise, the
+ * file is read into a buffer.
+ */
+class MemoryMappedFile {
+ public:
+  explicit MemoryMappedFile(const std::string& filename) :
+#if defined(_WIN32)
+    _buffer(),
+#else
+    _fd(-1),
+#endif
+    _data(nullptr),
+    _size(0),
+    _is_open(false) {
+    open(filename);
+  }
+
+  ~MemoryMappedFile() {
+#if !defined(_WIN32)
+    if (_data != nullptr) {
+      munmap(const_cast<char*>(_data), _size);
+    }
+    if (_fd != -1) {
+      close(_fd);
+    }
+#endif
+  }
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator= (const MemoryMappedFile&) = delete;
+
+  MemoryMappedFile(MemoryMappedFile&&) = delete;
+  MemoryMappedFile& operator= (MemoryMappedFile&&) = delete;
+
+  bool isOpen() const {
+    return _is_open;
+  }
+
+  const char* data() const {
+    return _data;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+#if defined(_WIN32)
+  void open(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (file) {
+      _buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+      _data = _buffer.data();
+      _size = _buffer.size();
+      _is_open = true;
+    }
+  }
+
+  std::vector<char> _buffer;
+#else
+  void open(const std::string& filename) {
+    _fd = ::open(filename.c_str(), O_RDONLY);
+    if (_fd == -1) {
+      return;
+    }
+    struct stat file_info;
+    if (fstat(_fd, &file_info) == -1) {
+      return;
+    }
+    _size = static_cast<size_t>(file_info.st_size);
+    _is_open = true;
+    if (_size == 0) {
+      return;
+    }
+    void* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (mapping == MAP_FAILED) {
+      _size = 0;
+      _is_open = false;
+      return;
+    }
+    // The file is usually scanned by several threads at once.
+    madvise(mapping, _size, MADV_WILLNEED);
+    _data = static_cast<const char*>(mapping);
+  }
+
+  int _fd;
+#endif
+  const char* _data;
+  size_t _size;
+  bool _is_open;
+};
+}  // namespace io
+}  // namespace kahypar
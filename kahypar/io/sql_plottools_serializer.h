@@ -126,6 +126,8 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
       << " louvain_edge_weight=" << context.preprocessing.community_detection.edge_weight
       << " reuse_community_structure=" << std::boolalpha
       << context.preprocessing.community_detection.reuse_communities
+      << " stream_louvain_bipartite_graph=" << std::boolalpha
+      << context.preprocessing.community_detection.stream_bipartite_graph
       << " coarsening_algo=" << context.coarsening.algorithm
       << " coarsening_max_allowed_weight_multiplier="
       << context.coarsening.max_allowed_weight_multiplier
@@ -175,18 +177,30 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
         << " IP_local_search_fm_max_number_of_fruitless_moves="
         << context.initial_partitioning.local_search.fm.max_number_of_fruitless_moves
         << " IP_local_search_fm_adaptive_stopping_alpha="
-        << context.initial_partitioning.local_search.fm.adaptive_stopping_alpha;
+        << context.initial_partitioning.local_search.fm.adaptive_stopping_alpha
+        << " IP_local_search_fm_priority_queue="
+        << context.initial_partitioning.local_search.fm.priority_queue
+        << " IP_local_search_fm_max_bucket_queue_gain="
+        << context.initial_partitioning.local_search.fm.max_bucket_queue_gain;
   }
   oss << " local_search_algorithm=" << context.local_search.algorithm
-      << " local_search_iterations_per_level=" << context.local_search.iterations_per_level;
+      << " local_search_iterations_per_level=" << context.local_search.iterations_per_level
+      << " local_search_uncontraction_batch_size="
+      << context.local_search.uncontraction_batch_size;
   if (context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
       context.local_search.algorithm == RefinementAlgorithm::kway_fm ||
-      context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1) {
+      context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+      context.local_search.algorithm == RefinementAlgorithm::parallel_kway_fm_km1) {
     oss << " local_search_fm_stopping_rule=" << context.local_search.fm.stopping_rule
         << " local_search_fm_max_number_of_fruitless_moves="
         << context.local_search.fm.max_number_of_fruitless_moves
         << " local_search_fm_adaptive_stopping_alpha="
-        << context.local_search.fm.adaptive_stopping_alpha;
+        << context.local_search.fm.adaptive_stopping_alpha
+        << " local_search_fm_priority_queue=" << context.local_search.fm.priority_queue
+        << " local_search_fm_max_bucket_queue_gain="
+        << context.local_search.fm.max_bucket_queue_gain
+        << " local_search_fm_max_gain_cache_arena_size="
+        << context.local_search.fm.max_gain_cache_arena_size;
   }
   oss << " iteration=" << iteration;
   for (PartitionID i = 0; i != hypergraph.k(); ++i) {
@@ -35,6 +35,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 
 namespace kahypar {
 class CoarsenerBase {
@@ -54,7 +55,8 @@ class CoarsenerBase {
     _context(context),
     _history(),
     _max_hn_weights(),
-    _hypergraph_pruner(_hg.initialNumNodes()) {
+    _hypergraph_pruner(_hg.initialNumNodes()),
+    _pass_representatives() {
     _history.reserve(_hg.initialNumNodes());
     _max_hn_weights.reserve(_hg.initialNumNodes());
     _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.initialNumNodes(),
@@ -70,14 +72,22 @@ class CoarsenerBase {
   CoarsenerBase& operator= (CoarsenerBase&&) = delete;
 
  protected:
-  void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
+  // ! If defer_parallel_he_removal is set, parallel hyperedges are not removed after the
+  // ! contraction. Instead, rep_node is remembered and its incident hyperedges are checked
+  // ! in the next call of removeParallelHyperedgesOfPass().
+  void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node,
+                          const bool defer_parallel_he_removal = false) {
     _history.emplace_back(_hg.contract(rep_node, contracted_node));
     if (_hg.nodeWeight(rep_node) > _max_hn_weights.back().max_weight) {
       _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.currentNumNodes(),
                                                           _hg.nodeWeight(rep_node) });
     }
     removeSingleNodeHyperedges();
-    removeParallelHyperedges();
+    if (defer_parallel_he_removal) {
+      _pass_representatives.push_back(rep_node);
+    } else {
+      removeParallelHyperedges();
+    }
   }
 
   void removeSingleNodeHyperedges() {
@@ -92,6 +102,17 @@ class CoarsenerBase {
     // _context.stats.add(StatTag::Coarsening, "numRemovedParalellHEs", removed_parallel_hes);
   }
 
+  // ! Removes all parallel hyperedges created by deferred contractions at once.
+  // ! The removed hyperedges are stored in the memento of the last contraction.
+  void removeParallelHyperedgesOfPass() {
+    if (!_pass_representatives.empty()) {
+      _hypergraph_pruner.removeParallelHyperedgesOfPass(_hg, _history.back(),
+                                                        _pass_representatives,
+                                                        _context.shared_memory.num_threads);
+      _pass_representatives.clear();
+    }
+  }
+
   void restoreParallelHyperedges() {
     _hypergraph_pruner.restoreParallelHyperedges(_hg, _history.back());
   }
@@ -101,7 +122,10 @@ class CoarsenerBase {
   }
 
   void initializeRefiner(IRefiner& refiner) {
-#ifdef USE_BUCKET_QUEUE
+    if (!requiresMaxGain(_context)) {
+      refiner.initialize(0);
+      return;
+    }
     HyperedgeID max_degree = 0;
     for (const HypernodeID& hn : _hg.nodes()) {
       max_degree = std::max(max_degree, _hg.nodeDegree(hn));
@@ -112,10 +136,7 @@ class CoarsenerBase {
     }
     max_he_weight = std::max(max_he_weight,
                              _hypergraph_pruner.maxRemovedSingleNodeHyperedgeWeight());
-    refiner.initialize(static_cast<HyperedgeWeight>(max_degree * max_he_weight));
-#else
-    refiner.initialize(0);
-#endif
+    refiner.initialize(maxGain(max_degree, max_he_weight));
   }
 
   void performLocalSearch(IRefiner& refiner, std::vector<HypernodeID>& refinement_nodes,
@@ -166,5 +187,6 @@ class CoarsenerBase {
   std::vector<CoarseningMemento> _history;
   std::vector<CurrentMaxNodeWeight> _max_hn_weights;
   HypergraphPruner _hypergraph_pruner;
+  std::vector<HypernodeID> _pass_representatives;
 };
 }  // namespace kahypar
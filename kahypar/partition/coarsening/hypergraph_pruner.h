@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "kahypar/definitions.h"
 #include "kahypar/partition/coarsening/coarsening_memento.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/stats.h"
 
 namespace kahypar {
@@ -50,11 +52,17 @@ class HypergraphPruner {
 
  public:
   explicit HypergraphPruner(const HypernodeID max_num_nodes) :
+    _max_num_nodes(max_num_nodes),
     _max_removed_single_node_he_weight(0),
     _removed_single_node_hyperedges(),
     _removed_parallel_hyperedges(),
     _fingerprints(),
-    _contained_hypernodes(max_num_nodes) { }
+    _contained_hypernodes(max_num_nodes),
+    _touched_hyperedges(),
+    _fingerprint_table(),
+    _bucket_begin(),
+    _detected_parallel_hyperedges(),
+    _thread_contained_hypernodes() { }
 
   HypergraphPruner(const HypergraphPruner&) = delete;
   HypergraphPruner& operator= (const HypergraphPruner&) = delete;
@@ -215,25 +223,66 @@ class HypergraphPruner {
     return removed_parallel_hes;
   }
 
-  bool isParallelHyperedge(Hypergraph& hypergraph, const HyperedgeID he) const {
-    bool is_parallel = true;
-    for (const HypernodeID& pin : hypergraph.pins(he)) {
-      if (!_contained_hypernodes[pin]) {
-        is_parallel = false;
-        break;
+  // Batched variant of removeParallelHyperedges that is used if parallel hyperedges are
+  // only removed once per coarsening pass. It considers all hyperedges incident to the
+  // given representatives (i.e., all hyperedges touched by the contractions of the pass).
+  // Instead of sorting the fingerprints of each representative separately, the fingerprints
+  // of all touched hyperedges are distributed into one global hash table (counting sort
+  // on the lower bits of the hash). Parallel hyperedges always end up in the same bucket,
+  // so buckets can be checked independently and concurrently by num_threads threads.
+  // The removal itself is done sequentially in bucket order. Thus the result does not
+  // depend on the number of threads.
+  // All removed hyperedges are recorded in the given memento, which has to be the memento of
+  // the last contraction of the pass. Since uncoarsening processes the mementos in reverse
+  // order, these hyperedges are restored before any contraction of the pass is undone.
+  HyperedgeID removeParallelHyperedgesOfPass(Hypergraph& hypergraph,
+                                             CoarseningMemento& memento,
+                                             const std::vector<HypernodeID>& representatives,
+                                             const size_t num_threads = 1) {
+    ASSERT(memento.parallel_hes_size == 0, "Memento already contains parallel hyperedges");
+    memento.parallel_hes_begin = _removed_parallel_hyperedges.size();
+
+    createFingerprintTable(hypergraph, representatives);
+    const size_t num_buckets = _bucket_begin.size() - 1;
+    const size_t threads = std::max(std::min(num_threads, num_buckets), static_cast<size_t>(1));
+    if (_detected_parallel_hyperedges.size() < threads) {
+      _detected_parallel_hyperedges.resize(threads);
+    }
+    while (_thread_contained_hypernodes.size() + 1 < threads) {
+      _thread_contained_hypernodes.emplace_back(
+        std::make_unique<ds::FastResetFlagArray<uint64_t> >(_max_num_nodes));
+    }
+
+    const size_t buckets_per_thread = (num_buckets + threads - 1) / threads;
+    parallel::executeConcurrent(threads, [&](const size_t thread_id) {
+        ds::FastResetFlagArray<uint64_t>& contained_hypernodes =
+          thread_id == 0 ? _contained_hypernodes : *_thread_contained_hypernodes[thread_id - 1];
+        std::vector<ParallelHE>& detected = _detected_parallel_hyperedges[thread_id];
+        detected.clear();
+        const size_t first_bucket = thread_id * buckets_per_thread;
+        const size_t last_bucket = std::min(first_bucket + buckets_per_thread, num_buckets);
+        for (size_t bucket = first_bucket; bucket < last_bucket; ++bucket) {
+          detectParallelHyperedgesInBucket(hypergraph, bucket, contained_hypernodes, detected);
+        }
+      });
+
+    HyperedgeID removed_parallel_hes = 0;
+    for (size_t thread_id = 0; thread_id < threads; ++thread_id) {
+      for (const ParallelHE& parallel_he : _detected_parallel_hyperedges[thread_id]) {
+        removeParallelHyperedge(hypergraph, parallel_he.representative_id, parallel_he.removed_id);
+        ++removed_parallel_hes;
       }
     }
-    DBG << "HE" << he << "is parallel HE=" << is_parallel;
-    return is_parallel;
+    memento.parallel_hes_size = removed_parallel_hes;
+    return removed_parallel_hes;
+  }
+
+  bool isParallelHyperedge(Hypergraph& hypergraph, const HyperedgeID he) const {
+    return isParallelHyperedge(hypergraph, he, _contained_hypernodes);
   }
 
   void fillProbeBitset(Hypergraph& hypergraph, const HyperedgeID he) {
-    _contained_hypernodes.reset();
-    DBG << "Filling Bitprobe Set for HE" << he;
-    for (const HypernodeID& pin : hypergraph.pins(he)) {
-      DBG << "_contained_hypernodes[" << pin << "]=1";
-      _contained_hypernodes.set(pin, true);
-    }
+    fillProbeBitset(hypergraph, he, _contained_hypernodes);
   }
 
   void removeParallelHyperedge(Hypergraph& hypergraph,
@@ -281,10 +330,114 @@ class HypergraphPruner {
   }
 
  private:
+  static bool isParallelHyperedge(const Hypergraph& hypergraph, const HyperedgeID he,
+                                  const ds::FastResetFlagArray<uint64_t>& contained_hypernodes) {
+    bool is_parallel = true;
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      if (!contained_hypernodes[pin]) {
+        is_parallel = false;
+        break;
+      }
+    }
+    DBG << "HE" << he << "is parallel HE=" << is_parallel;
+    return is_parallel;
+  }
+
+  static void fillProbeBitset(const Hypergraph& hypergraph, const HyperedgeID he,
+                              ds::FastResetFlagArray<uint64_t>& contained_hypernodes) {
+    contained_hypernodes.reset();
+    DBG << "Filling Bitprobe Set for HE" << he;
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      DBG << "_contained_hypernodes[" << pin << "]=1";
+      contained_hypernodes.set(pin, true);
+    }
+  }
+
+  // Collects the fingerprints of all enabled hyperedges incident to the representatives
+  // and distributes them into 2^x >= #fingerprints buckets. Bucket b consists of the entries
+  // [_bucket_begin[b], _bucket_begin[b + 1]) of _fingerprint_table. Within each bucket,
+  // the hyperedges are ordered by ID.
+  void createFingerprintTable(const Hypergraph& hypergraph,
+                              const std::vector<HypernodeID>& representatives) {
+    _touched_hyperedges.clear();
+    for (const HypernodeID& hn : representatives) {
+      if (hypergraph.nodeIsEnabled(hn)) {
+        for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+          _touched_hyperedges.push_back(he);
+        }
+      }
+    }
+    std::sort(_touched_hyperedges.begin(), _touched_hyperedges.end());
+    _touched_hyperedges.erase(std::unique(_touched_hyperedges.begin(), _touched_hyperedges.end()),
+                              _touched_hyperedges.end());
+
+    size_t num_buckets = 1;
+    while (num_buckets < _touched_hyperedges.size()) {
+      num_buckets <<= 1;
+    }
+    const size_t bucket_mask = num_buckets - 1;
+
+    _bucket_begin.assign(num_buckets + 1, 0);
+    for (const HyperedgeID& he : _touched_hyperedges) {
+      ++_bucket_begin[(hypergraph.edgeHash(he) & bucket_mask) + 1];
+    }
+    for (size_t bucket = 1; bucket <= num_buckets; ++bucket) {
+      _bucket_begin[bucket] += _bucket_begin[bucket - 1];
+    }
+    // _bucket_begin[b] is used as insertion position of bucket b and afterwards
+    // points to the beginning of bucket b + 1.
+    _fingerprint_table.resize(_touched_hyperedges.size());
+    for (const HyperedgeID& he : _touched_hyperedges) {
+      const size_t hash = hypergraph.edgeHash(he);
+      _fingerprint_table[_bucket_begin[hash & bucket_mask]++] = Fingerprint { he, hash };
+    }
+    for (size_t bucket = num_buckets; bucket > 0; --bucket) {
+      _bucket_begin[bucket] = _bucket_begin[bucket - 1];
+    }
+    _bucket_begin[0] = 0;
+  }
+
+  // Same pairwise comparison as in removeParallelHyperedges, restricted to one bucket.
+  // Detected parallel hyperedges are invalidated in the table, but not yet removed.
+  void detectParallelHyperedgesInBucket(const Hypergraph& hypergraph, const size_t bucket,
+                                        ds::FastResetFlagArray<uint64_t>& contained_hypernodes,
+                                        std::vector<ParallelHE>& detected) {
+    const size_t bucket_end = _bucket_begin[bucket + 1];
+    for (size_t i = _bucket_begin[bucket]; i < bucket_end; ++i) {
+      if (_fingerprint_table[i].id == kInvalidID) {
+        continue;
+      }
+      bool filled_probe_bitset = false;
+      for (size_t j = i + 1; j < bucket_end; ++j) {
+        if (_fingerprint_table[j].id != kInvalidID &&
+            _fingerprint_table[i].hash == _fingerprint_table[j].hash &&
+            hypergraph.edgeSize(_fingerprint_table[i].id) ==
+            hypergraph.edgeSize(_fingerprint_table[j].id)) {
+          if (!filled_probe_bitset) {
+            fillProbeBitset(hypergraph, _fingerprint_table[i].id, contained_hypernodes);
+            filled_probe_bitset = true;
+          }
+          if (isParallelHyperedge(hypergraph, _fingerprint_table[j].id, contained_hypernodes)) {
+            detected.emplace_back(ParallelHE { _fingerprint_table[i].id,
+                                               _fingerprint_table[j].id });
+            _fingerprint_table[j].id = kInvalidID;
+          }
+        }
+      }
+    }
+  }
+
+  const HypernodeID _max_num_nodes;
   HyperedgeWeight _max_removed_single_node_he_weight;
   std::vector<HyperedgeID> _removed_single_node_hyperedges;
   std::vector<ParallelHE> _removed_parallel_hyperedges;
   std::vector<Fingerprint> _fingerprints;
   ds::FastResetFlagArray<uint64_t> _contained_hypernodes;
+  // Data structures of the batched parallel hyperedge removal
+  std::vector<HyperedgeID> _touched_hyperedges;
+  std::vector<Fingerprint> _fingerprint_table;
+  std::vector<size_t> _bucket_begin;
+  std::vector<std::vector<ParallelHE> > _detected_parallel_hyperedges;
+  std::vector<std::unique_ptr<ds::FastResetFlagArray<uint64_t> > > _thread_contained_hypernodes;
 };
 }  // namespace kahypar
@@ -27,6 +27,7 @@
 
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
@@ -34,6 +35,7 @@
 #include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
 #include "kahypar/partition/coarsening/vertex_pair_rater.h"
 
 namespace kahypar {
@@ -105,7 +107,8 @@ class MLCoarsener final : public ICoarsener,
             _rater.markAsMatched(rating.target);
             // if (_hg.nodeDegree(hn) > _hg.nodeDegree(rating.target)) {
 
-            performContraction(hn, rating.target);
+            performContraction(hn, rating.target,
+                               _context.coarsening.remove_parallel_hes_per_pass);
             // } else {
             //   contract(rating.target, hn);
             // }
@@ -116,6 +119,7 @@ class MLCoarsener final : public ICoarsener,
           }
         }
       }
+      removeParallelHyperedgesOfPass();
 
       if (num_hns_before_pass == _hg.currentNumNodes()) {
         break;
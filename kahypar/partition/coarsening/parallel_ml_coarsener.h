@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_community_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
+#include "kahypar/partition/coarsening/vertex_pair_rater.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
+
+namespace kahypar {
+/*!
+ * Multi-threaded variant of the MLCoarsener.
+ *
+ * Each pass is split into two phases: First, all threads rate the hypernodes
+ * of the current hypergraph concurrently, each using its own VertexPairRater.
+ * Since the hypergraph is not modified during this phase, each hypernode u
+ * obtains a preferred contraction partner target(u) (i.e., a clustering).
+ * Afterwards, the clusters are contracted sequentially in the (random) order
+ * of the pass. Since the representative of a hypernode might have changed
+ * due to previous contractions, each pair (u, target(u)) is mapped to the
+ * current representatives of u and target(u) and contracted only if this
+ * contraction is still feasible w.r.t. the maximum allowed node weight and
+ * all contraction policies. Since all contractions are performed via
+ * performContraction, the contraction history is the same as for sequential
+ * coarsening and the usual uncoarsening/refinement scheme can be used.
+ *
+ * For a fixed number of threads, the result is deterministic w.r.t. the seed.
+ */
+template <class ScorePolicy = HeavyEdgeScore,
+          class HeavyNodePenaltyPolicy = NoWeightPenalty,
+          class CommunityPolicy = UseCommunityStructure,
+          class RatingPartitionPolicy = NormalPartitionPolicy,
+          class AcceptancePolicy = BestRatingPreferringUnmatched<>,
+          class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+          typename RatingType = RatingType>
+class ParallelMLCoarsener final : public ICoarsener,
+                                  private VertexPairCoarsenerBase<>{
+ private:
+  static constexpr bool debug = false;
+
+  static constexpr HypernodeID kInvalidTarget = std::numeric_limits<HypernodeID>::max();
+
+  using Base = VertexPairCoarsenerBase;
+  using Rater = VertexPairRater<ScorePolicy,
+                                HeavyNodePenaltyPolicy,
+                                CommunityPolicy,
+                                RatingPartitionPolicy,
+                                AcceptancePolicy,
+                                FixedVertexPolicy,
+                                RatingType>;
+  using Rating = typename Rater::Rating;
+
+ public:
+  ParallelMLCoarsener(Hypergraph& hypergraph, const Context& context,
+                      const HypernodeWeight weight_of_heaviest_node) :
+    Base(hypergraph, context, weight_of_heaviest_node),
+    _raters(),
+    _targets(),
+    _representative(_hg.initialNumNodes()) { }
+
+  ~ParallelMLCoarsener() override = default;
+
+  ParallelMLCoarsener(const ParallelMLCoarsener&) = delete;
+  ParallelMLCoarsener& operator= (const ParallelMLCoarsener&) = delete;
+
+  ParallelMLCoarsener(ParallelMLCoarsener&&) = delete;
+  ParallelMLCoarsener& operator= (ParallelMLCoarsener&&) = delete;
+
+ private:
+  void coarsenImpl(const HypernodeID limit) override final {
+    // The number of threads is read here, because the context may be
+    // configured after the coarsener was constructed.
+    const size_t num_threads = std::max(_context.shared_memory.num_threads,
+                                        static_cast<size_t>(1));
+    while (_raters.size() < num_threads) {
+      _raters.emplace_back(new Rater(_hg, _context));
+    }
+
+    int pass_nr = 0;
+    std::vector<HypernodeID> current_hns;
+    while (_hg.currentNumNodes() > limit) {
+      DBG << V(pass_nr);
+      DBG << V(_hg.currentNumNodes());
+      DBG << V(_hg.currentNumEdges());
+      current_hns.clear();
+      const HypernodeID num_hns_before_pass = _hg.currentNumNodes();
+      for (const HypernodeID& hn : _hg.nodes()) {
+        current_hns.push_back(hn);
+        _representative[hn] = hn;
+      }
+      Randomize::instance().shuffleVector(current_hns, current_hns.size());
+
+      computeClustering(current_hns, num_threads);
+
+      for (size_t i = 0; i < current_hns.size(); ++i) {
+        if (_targets[i] != kInvalidTarget) {
+          const HypernodeID rep_u = findRepresentative(current_hns[i]);
+          const HypernodeID rep_v = findRepresentative(_targets[i]);
+          if (rep_u != rep_v && isFeasibleContraction(rep_u, rep_v)) {
+            performContraction(rep_u, rep_v, _context.coarsening.remove_parallel_hes_per_pass);
+            _representative[rep_v] = rep_u;
+          }
+        }
+        if (_hg.currentNumNodes() <= limit) {
+          break;
+        }
+      }
+      removeParallelHyperedgesOfPass();
+
+      if (num_hns_before_pass == _hg.currentNumNodes()) {
+        break;
+      }
+      ++pass_nr;
+    }
+  }
+
+  bool uncoarsenImpl(IRefiner& refiner) override final {
+    return doUncoarsen(refiner);
+  }
+
+  // ! Rates all hypernodes of the current pass concurrently. Each thread works on
+  // ! a contiguous block of current_hns and uses its own rater and random generator.
+  void computeClustering(const std::vector<HypernodeID>& current_hns,
+                         const size_t num_threads) {
+    _targets.assign(current_hns.size(), kInvalidTarget);
+    const int pass_seed = Randomize::instance().newRandomSeed();
+    const size_t threads = std::min(num_threads, current_hns.size());
+    const size_t block_size = threads > 0 ? (current_hns.size() + threads - 1) / threads : 0;
+    parallel::executeConcurrent(threads, [&](const size_t thread_id) {
+        if (thread_id > 0) {
+          Randomize::instance().setSeed(pass_seed + static_cast<int>(thread_id));
+        }
+        Rater& rater = *_raters[thread_id];
+        rater.resetMatches();
+        const size_t begin = thread_id * block_size;
+        const size_t end = std::min(begin + block_size, current_hns.size());
+        for (size_t i = begin; i < end; ++i) {
+          const HypernodeID hn = current_hns[i];
+          const Rating rating = rater.rate(hn);
+          if (rating.target != kInvalidTarget) {
+            rater.markAsMatched(hn);
+            rater.markAsMatched(rating.target);
+            _targets[i] = rating.target;
+          }
+        }
+      });
+  }
+
+  HypernodeID findRepresentative(const HypernodeID hn) {
+    HypernodeID rep = hn;
+    while (_representative[rep] != rep) {
+      rep = _representative[rep];
+    }
+    // path compression
+    HypernodeID cur = hn;
+    while (_representative[cur] != rep) {
+      const HypernodeID next = _representative[cur];
+      _representative[cur] = rep;
+      cur = next;
+    }
+    return rep;
+  }
+
+  // ! The clustering was computed on the hypergraph at the beginning of the pass.
+  // ! Therefore all constraints have to be checked again for the current representatives.
+  bool isFeasibleContraction(const HypernodeID u, const HypernodeID v) const {
+    return _hg.nodeWeight(u) + _hg.nodeWeight(v) <= _context.coarsening.max_allowed_node_weight &&
+           RatingPartitionPolicy::accept(_hg, _context, u, v) &&
+           CommunityPolicy::sameCommunity(_hg.communities(), u, v) &&
+           FixedVertexPolicy::acceptContraction(_hg, _context, u, v);
+  }
+
+  using Base::_pq;
+  using Base::_hg;
+  using Base::_context;
+  using Base::_history;
+  std::vector<std::unique_ptr<Rater> > _raters;
+  std::vector<HypernodeID> _targets;
+  std::vector<HypernodeID> _representative;
+};
+
+template <class ScorePolicy, class HeavyNodePenaltyPolicy, class CommunityPolicy,
+          class RatingPartitionPolicy, class AcceptancePolicy, class FixedVertexPolicy,
+          typename RatingType>
+constexpr HypernodeID ParallelMLCoarsener<ScorePolicy, HeavyNodePenaltyPolicy, CommunityPolicy,
+                                          RatingPartitionPolicy, AcceptancePolicy,
+                                          FixedVertexPolicy, RatingType>::kInvalidTarget;
+}  // namespace kahypar
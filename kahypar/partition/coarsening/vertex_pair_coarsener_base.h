@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/definitions.h"
 #include "kahypar/meta/int_to_type.h"
 #include "kahypar/partition/coarsening/coarsener_base.h"
@@ -92,6 +93,11 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     changes.representative.push_back(0);
     changes.contraction_partner.push_back(0);
 
+    const size_t batch_size = uncontractionBatchSize();
+    ds::FastResetFlagArray<> batch_hns;
+    if (batch_size > 1) {
+      batch_hns.setSize(_hg.initialNumNodes());
+    }
 
     while (!_history.empty()) {
       if (time_limit::isSoftTimeLimitExceeded(_context, _history.size())) {
@@ -113,10 +119,14 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
       }
 
       refinement_nodes.clear();
-      refinement_nodes.push_back(_history.back().contraction_memento.u);
-      refinement_nodes.push_back(_history.back().contraction_memento.v);
+      if (batch_size > 1) {
+        uncontractBatch(batch_size, batch_hns, refinement_nodes, changes);
+      } else {
+        refinement_nodes.push_back(_history.back().contraction_memento.u);
+        refinement_nodes.push_back(_history.back().contraction_memento.v);
 
-      uncontract(changes);
+        uncontract(changes);
+      }
 
       CoarsenerBase::performLocalSearch(refiner, refinement_nodes, current_metrics, changes);
       changes.representative[0] = 0;
@@ -178,6 +188,40 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     _history.pop_back();
   }
 
+  // ! Uncontracts up to batch_size mementos from the top of the history whose
+  // ! hypernodes are pairwise distinct. The uncontracted hypernodes of all mementos
+  // ! are refined together afterwards.
+  void uncontractBatch(const size_t batch_size, ds::FastResetFlagArray<>& batch_hns,
+                       std::vector<HypernodeID>& refinement_nodes,
+                       UncontractionGainChanges& changes) {
+    batch_hns.reset();
+    size_t num_uncontractions = 0;
+    while (!_history.empty() && num_uncontractions < batch_size) {
+      const HypernodeID u = _history.back().contraction_memento.u;
+      const HypernodeID v = _history.back().contraction_memento.v;
+      if (batch_hns[u] || batch_hns[v]) {
+        break;
+      }
+      batch_hns.set(u, true);
+      batch_hns.set(v, true);
+      refinement_nodes.push_back(u);
+      refinement_nodes.push_back(v);
+      uncontract(changes);
+      ++num_uncontractions;
+    }
+    DBG << "Uncontracted batch of" << num_uncontractions << "mementos";
+  }
+
+  size_t uncontractionBatchSize() const {
+    // The gain cache of 2-way FM is updated using the gain changes of a single
+    // uncontraction. Therefore, these refiners always use n-level uncoarsening.
+    if (_context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
+        _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_hyperflow_cutter) {
+      return 1;
+    }
+    return std::max(_context.local_search.uncontraction_batch_size, static_cast<size_t>(1));
+  }
+
   template <typename Rater>
   void rateAllHypernodes(Rater& rater,
                          std::vector<HypernodeID>& target) {
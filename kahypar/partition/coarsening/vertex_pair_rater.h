@@ -115,7 +115,8 @@ class VertexPairRater {
       const HypernodeWeight target_weight = _hg.nodeWeight(tmp_target);
       HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u,
                                                                 target_weight);
-      penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
+      penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight),
+                                        static_cast<HypernodeWeight>(1)) : penalty;
       const RatingType tmp_rating = it->value / static_cast<double>(penalty);
       DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
       if (CommunityPolicy::sameCommunity(_hg.communities(), u, tmp_target) &&
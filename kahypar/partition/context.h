@@ -41,7 +41,7 @@ struct MinHashSparsifierParameters {
   uint32_t min_cluster_size = std::numeric_limits<uint32_t>::max();
   uint32_t num_hash_functions = std::numeric_limits<uint32_t>::max();
   uint32_t combined_num_hash_functions = std::numeric_limits<uint32_t>::max();
-  HypernodeID min_median_he_size = std::numeric_limits<uint32_t>::max();
+  HypernodeID min_median_he_size = std::numeric_limits<HypernodeID>::max();
   bool is_active = false;
 };
 
@@ -51,6 +51,9 @@ struct CommunityDetection {
   LouvainEdgeWeight edge_weight = LouvainEdgeWeight::UNDEFINED;
   uint32_t max_pass_iterations = std::numeric_limits<uint32_t>::max();
   double min_eps_improvement = std::numeric_limits<double>::max();
+  // The first Louvain level of a hypergraph evaluates its bipartite graph representation
+  // on the fly on the hypergraph instead of storing it explicitly.
+  bool stream_bipartite_graph = false;
 };
 
 struct PreprocessingParameters {
@@ -92,6 +95,8 @@ inline std::ostream& operator<< (std::ostream& str, const CommunityDetection& pa
       << params.edge_weight << std::endl;
   str << "  reuse community structure:          " << std::boolalpha
       << params.reuse_communities << std::endl;
+  str << "  stream bipartite graph:             " << std::boolalpha
+      << params.stream_bipartite_graph << std::noboolalpha << std::endl;
   return str;
 }
 
@@ -145,6 +150,9 @@ struct CoarseningParameters {
   RatingParameters rating = { };
   HypernodeID contraction_limit_multiplier = std::numeric_limits<HypernodeID>::max();
   double max_allowed_weight_multiplier = std::numeric_limits<double>::max();
+  // If set, pass-based coarseners (ml_style, parallel_ml_style) remove parallel
+  // hyperedges once at the end of each pass instead of after each contraction.
+  bool remove_parallel_hes_per_pass = false;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -157,6 +165,8 @@ inline std::ostream& operator<< (std::ostream& str, const CoarseningParameters&
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  max-allowed-weight-multiplier:      " << params.max_allowed_weight_multiplier << std::endl;
   str << "  contraction-limit-multiplier:       " << params.contraction_limit_multiplier << std::endl;
+  str << "  remove parallel HEs per pass:       " << std::boolalpha
+      << params.remove_parallel_hes_per_pass << std::endl;
   str << "  hypernode weight fraction:          ";
   // For the coarsening algorithm of the initial partitioning phase
   // these parameters are only known after main coarsening.
@@ -188,6 +198,14 @@ struct LocalSearchParameters {
     uint32_t max_number_of_fruitless_moves = std::numeric_limits<uint32_t>::max();
     double adaptive_stopping_alpha = std::numeric_limits<double>::max();
     RefinementStoppingRule stopping_rule = RefinementStoppingRule::UNDEFINED;
+    FMPriorityQueue priority_queue = FMPriorityQueue::binary_heap;
+    // The adaptive priority queue uses bucket queues on each coarsest level whose maximum
+    // possible gain (i.e., max. hypernode degree * max. hyperedge weight) does not exceed
+    // this value, and binary heaps otherwise.
+    HyperedgeWeight max_bucket_queue_gain = 4096;
+    // The k-way FM gain cache stores the gains of all hypernodes in one contiguous
+    // arena of n * k entries if it requires at most this many bytes.
+    size_t max_gain_cache_arena_size = static_cast<size_t>(1) << 30;
   };
 
   struct Flow {
@@ -208,6 +226,10 @@ struct LocalSearchParameters {
   HyperFlowCutter hyperflowcutter { };
   RefinementAlgorithm algorithm = RefinementAlgorithm::UNDEFINED;
   int iterations_per_level = std::numeric_limits<int>::max();
+  // Number of contractions that are undone before refinement is performed on
+  // all uncontracted hypernodes at once. A value of 1 corresponds to n-level
+  // uncoarsening; larger values trade quality for speed.
+  size_t uncontraction_batch_size = 1;
 };
 
 
@@ -215,9 +237,11 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
   str << "Local Search Parameters:" << std::endl;
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  iterations per level:               " << params.iterations_per_level << std::endl;
+  str << "  uncontraction batch size:           " << params.uncontraction_batch_size << std::endl;
   if (params.algorithm == RefinementAlgorithm::twoway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+      params.algorithm == RefinementAlgorithm::parallel_kway_fm_km1 ||
       params.algorithm == RefinementAlgorithm::twoway_fm_hyperflow_cutter ||
       params.algorithm == RefinementAlgorithm::kway_fm_hyperflow_cutter_km1 ||
       params.algorithm == RefinementAlgorithm::kway_fm_hyperflow_cutter) {
@@ -227,6 +251,11 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
     } else {
       str << "  adaptive stopping alpha:            " << params.fm.adaptive_stopping_alpha << std::endl;
     }
+    str << "  priority queue:                     " << params.fm.priority_queue << std::endl;
+    if (params.fm.priority_queue == FMPriorityQueue::adaptive) {
+      str << "  max. bucket queue gain:             " << params.fm.max_bucket_queue_gain << std::endl;
+    }
+    str << "  max. gain cache arena size:         " << params.fm.max_gain_cache_arena_size << std::endl;
   }
   if (params.algorithm == RefinementAlgorithm::twoway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm ||
@@ -390,6 +419,9 @@ struct EvolutionaryParameters {
   mutable std::vector<ClusterID> communities;
   bool unlimited_coarsening_contraction;
   bool random_vcycles;
+  // Number of iterations after which an island sends its best individual
+  // to its neighbor island (only used if shared_memory.num_threads > 1).
+  size_t migration_interval = 10;
 };
 
 inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters& params) {
@@ -401,6 +433,48 @@ inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters
   str << "  Combine Strategy                    " << params.combine_strategy << std::endl;
   str << "  Mutation Strategy                   " << params.mutate_strategy << std::endl;
   str << "  Diversification Interval            " << params.diversify_interval << std::endl;
+  str << "  Migration Interval                  " << params.migration_interval << std::endl;
+  return str;
+}
+
+struct SharedMemoryParameters {
+  // Number of threads used by the parallel components of the partitioner.
+  // num_threads = 1 executes all algorithms sequentially.
+  size_t num_threads = 1;
+  // Recursive bisection processes the two sub-hypergraphs of each bisection
+  // as independent tasks on num_threads threads.
+  bool parallel_recursive_bisection = false;
+  // The pool initial partitioner executes its algorithms and repetitions
+  // concurrently on private copies of the coarse hypergraph.
+  bool parallel_initial_partitioning_pool = false;
+  // Louvain community detection moves nodes in synchronous parallel rounds
+  // and contracts the communities of each level in parallel.
+  bool parallel_community_detection = false;
+  // The min-hash sparsifier calculates the min-hash signatures of disjoint
+  // blocks of vertices concurrently.
+  bool parallel_min_hash_sparsifier = false;
+  // Deduplication finds identical vertices and parallel hyperedges concurrently.
+  bool parallel_deduplication = false;
+  // k-way HyperFlowCutter refinement extracts and solves the flow problems of
+  // the block pairs of a matching of the quotient graph concurrently.
+  bool parallel_flow_refinement = false;
+};
+
+inline std::ostream& operator<< (std::ostream& str, const SharedMemoryParameters& params) {
+  str << "Shared Memory Parameters:" << std::endl;
+  str << "  # threads:                          " << params.num_threads << std::endl;
+  str << "  parallel recursive bisection:       " << std::boolalpha
+      << params.parallel_recursive_bisection << std::noboolalpha << std::endl;
+  str << "  parallel initial partitioning pool: " << std::boolalpha
+      << params.parallel_initial_partitioning_pool << std::noboolalpha << std::endl;
+  str << "  parallel community detection:       " << std::boolalpha
+      << params.parallel_community_detection << std::noboolalpha << std::endl;
+  str << "  parallel min-hash sparsifier:       " << std::boolalpha
+      << params.parallel_min_hash_sparsifier << std::noboolalpha << std::endl;
+  str << "  parallel deduplication:             " << std::boolalpha
+      << params.parallel_deduplication << std::noboolalpha << std::endl;
+  str << "  parallel flow refinement:           " << std::boolalpha
+      << params.parallel_flow_refinement << std::noboolalpha << std::endl;
   return str;
 }
 
@@ -414,6 +488,7 @@ class Context {
   InitialPartitioningParameters initial_partitioning { };
   LocalSearchParameters local_search { };
   EvolutionaryParameters evolutionary { };
+  SharedMemoryParameters shared_memory { };
   ContextType type = ContextType::main;
   mutable PartitioningStats stats;
   bool partition_evolutionary = false;
@@ -430,6 +505,7 @@ class Context {
     initial_partitioning(other.initial_partitioning),
     local_search(other.local_search),
     evolutionary(other.evolutionary),
+    shared_memory(other.shared_memory),
     type(other.type),
     stats(*this, &other.stats.topLevel()),
     partition_evolutionary(other.partition_evolutionary) { }
@@ -483,6 +559,9 @@ inline std::ostream& operator<< (std::ostream& str, const Context& context) {
       << context.initial_partitioning
       << context.local_search
       << "-------------------------------------------------------------------------------"
+      << std::endl
+      << context.shared_memory
+      << "-------------------------------------------------------------------------------"
       << std::endl;
   if (context.partition_evolutionary) {
     str << context.evolutionary
@@ -494,6 +573,7 @@ inline std::ostream& operator<< (std::ostream& str, const Context& context) {
 static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
   if (algo == RefinementAlgorithm::kway_fm ||
       algo == RefinementAlgorithm::kway_fm_km1 ||
+      algo == RefinementAlgorithm::parallel_kway_fm_km1 ||
       algo == RefinementAlgorithm::kway_hyperflow_cutter ||
       algo == RefinementAlgorithm::kway_fm_hyperflow_cutter ||
       algo == RefinementAlgorithm::kway_fm_hyperflow_cutter_km1) {
@@ -506,7 +586,8 @@ static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
     std::cin >> answer;
     answer = std::toupper(answer);
     if (answer == 'Y') {
-      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1) {
+      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1 ||
+          algo == RefinementAlgorithm::parallel_kway_fm_km1) {
         algo = RefinementAlgorithm::twoway_fm;
       } else if (algo == RefinementAlgorithm::kway_hyperflow_cutter) {
         algo = RefinementAlgorithm::twoway_hyperflow_cutter;
@@ -662,6 +743,7 @@ static inline void sanityCheck(const Hypergraph& hypergraph, Context& context) {
   if (context.partition.mode == Mode::direct_kway &&
       context.partition.objective == Objective::cut) {
     if (context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+        context.local_search.algorithm == RefinementAlgorithm::parallel_kway_fm_km1 ||
         context.local_search.algorithm == RefinementAlgorithm::kway_fm_hyperflow_cutter_km1) {
       LOG << "\nRefinement algorithm" << context.local_search.algorithm
           << "currently only works for connectivity (km1) optimization.";
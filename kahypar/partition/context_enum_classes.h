@@ -82,6 +82,7 @@ enum class CoarseningAlgorithm : uint8_t {
   heavy_full,
   heavy_lazy,
   ml_style,
+  parallel_ml_style,
   do_nothing,
   UNDEFINED
 };
@@ -90,6 +91,7 @@ enum class RefinementAlgorithm : uint8_t {
   twoway_fm,
   kway_fm,
   kway_fm_km1,
+  parallel_kway_fm_km1,
   twoway_fm_hyperflow_cutter,
   twoway_hyperflow_cutter,
   kway_hyperflow_cutter,
@@ -130,6 +132,13 @@ enum class RefinementStoppingRule : uint8_t {
   UNDEFINED
 };
 
+enum class FMPriorityQueue : uint8_t {
+  binary_heap,
+  bucket_queue,
+  adaptive,
+  UNDEFINED
+};
+
 enum class Objective : uint8_t {
   cut,
   km1,
@@ -318,6 +327,7 @@ static std::ostream& operator<< (std::ostream& os, const CoarseningAlgorithm& al
     case CoarseningAlgorithm::heavy_full: return os << "heavy_full";
     case CoarseningAlgorithm::heavy_lazy: return os << "heavy_lazy";
     case CoarseningAlgorithm::ml_style: return os << "ml_style";
+    case CoarseningAlgorithm::parallel_ml_style: return os << "parallel_ml_style";
     case CoarseningAlgorithm::do_nothing: return os << "do_nothing";
     case CoarseningAlgorithm::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
@@ -330,6 +340,7 @@ static std::ostream& operator<< (std::ostream& os, const RefinementAlgorithm& al
     case RefinementAlgorithm::twoway_fm: return os << "twoway_fm";
     case RefinementAlgorithm::kway_fm: return os << "kway_fm";
     case RefinementAlgorithm::kway_fm_km1: return os << "kway_fm_km1";
+    case RefinementAlgorithm::parallel_kway_fm_km1: return os << "parallel_kway_fm_km1";
     case RefinementAlgorithm::twoway_hyperflow_cutter: return os << "twoway_hyperflow_cutter";
     case RefinementAlgorithm::twoway_fm_hyperflow_cutter: return os << "twoway_fm_hyperflow_cutter";
     case RefinementAlgorithm::kway_hyperflow_cutter: return os << "kway_hyperflow_cutter";
@@ -385,6 +396,17 @@ static std::ostream& operator<< (std::ostream& os, const RefinementStoppingRule&
   return os << static_cast<uint8_t>(rule);
 }
 
+static std::ostream& operator<< (std::ostream& os, const FMPriorityQueue& pq) {
+  switch (pq) {
+    case FMPriorityQueue::binary_heap: return os << "binary_heap";
+    case FMPriorityQueue::bucket_queue: return os << "bucket_queue";
+    case FMPriorityQueue::adaptive: return os << "adaptive";
+    case FMPriorityQueue::UNDEFINED: return os << "UNDEFINED";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(pq);
+}
+
 static std::ostream& operator<< (std::ostream& os, const FlowExecutionMode& mode) {
   switch (mode) {
     case FlowExecutionMode::constant: return os << "constant";
@@ -495,6 +517,19 @@ static RefinementStoppingRule stoppingRuleFromString(const std::string& rule) {
   return RefinementStoppingRule::simple;
 }
 
+static FMPriorityQueue fmPriorityQueueFromString(const std::string& pq) {
+  if (pq == "binary_heap") {
+    return FMPriorityQueue::binary_heap;
+  } else if (pq == "bucket_queue") {
+    return FMPriorityQueue::bucket_queue;
+  } else if (pq == "adaptive") {
+    return FMPriorityQueue::adaptive;
+  }
+  LOG << "No valid priority queue for FM.";
+  exit(0);
+  return FMPriorityQueue::binary_heap;
+}
+
 static CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type) {
   if (type == "heavy_full") {
     return CoarseningAlgorithm::heavy_full;
@@ -502,6 +537,8 @@ static CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type
     return CoarseningAlgorithm::heavy_lazy;
   } else if (type == "ml_style") {
     return CoarseningAlgorithm::ml_style;
+  } else if (type == "parallel_ml_style") {
+    return CoarseningAlgorithm::parallel_ml_style;
   } else if (type == "do_nothing") {
     return CoarseningAlgorithm::do_nothing;
   }
@@ -517,6 +554,8 @@ static RefinementAlgorithm refinementAlgorithmFromString(const std::string& type
     return RefinementAlgorithm::kway_fm;
   } else if (type == "kway_fm_km1") {
     return RefinementAlgorithm::kway_fm_km1;
+  } else if (type == "parallel_kway_fm_km1") {
+    return RefinementAlgorithm::parallel_kway_fm_km1;
   } else if (type == "twoway_hyperflow_cutter") {
     return RefinementAlgorithm::twoway_hyperflow_cutter;
   } else if (type == "kway_hyperflow_cutter") {
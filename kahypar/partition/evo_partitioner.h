@@ -23,6 +23,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
@@ -35,6 +39,7 @@
 #include "kahypar/partition/evolutionary/mutate.h"
 #include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/partition/evolutionary/probability_tables.h"
+#include "kahypar/utils/parallel.h"
 
 
 namespace kahypar {
@@ -42,6 +47,26 @@ class EvoPartitioner {
  private:
   static constexpr bool debug = false;
 
+  // ! An island of the island model owns a private copy of the hypergraph and
+  // ! context as well as its own sub-population. Other islands deposit the
+  // ! partitions of their migrating individuals in its inbox.
+  struct Island {
+    Island(const Hypergraph& hypergraph, const Context& context) :
+      hypergraph(ds::copyHypergraph(hypergraph)),
+      context(context),
+      population(),
+      inbox(),
+      inbox_mutex(),
+      last_emigrant_fitness(std::numeric_limits<HyperedgeWeight>::max()) { }
+
+    Hypergraph hypergraph;
+    Context context;
+    Population population;
+    std::vector<std::vector<PartitionID> > inbox;
+    std::mutex inbox_mutex;
+    HyperedgeWeight last_emigrant_fitness;
+  };
+
  public:
   explicit EvoPartitioner(const Context& context) :
     _timelimit(),
@@ -52,7 +77,12 @@ class EvoPartitioner {
   inline void partition(Hypergraph& hg, Context& context) {
     context.partition_evolutionary = true;
 
-    generateInitialPopulation(hg, context);
+    if (context.shared_memory.num_threads > 1) {
+      partitionWithIslands(hg, context);
+      return;
+    }
+
+    generateInitialPopulation(hg, context, _population, 1);
 
     while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
       ++context.evolutionary.iteration;
@@ -64,21 +94,7 @@ class EvoPartitioner {
       }
 
 
-      EvoDecision decision = decideNextMove(context);
-      DBG << V(decision);
-      switch (decision) {
-        case EvoDecision::mutation:
-          performMutation(hg, context);
-          DBG << _population;
-          break;
-        case EvoDecision::combine:
-          performCombine(hg, context);
-          DBG << _population;
-          break;
-        default:
-          LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
-          std::exit(EXIT_FAILURE);
-      }
+      performEvolutionaryStep(hg, context, _population);
     }
     hg.reset();
     hg.setPartition(_population.individualAt(_population.best()).partition());
@@ -92,11 +108,149 @@ class EvoPartitioner {
   FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
   FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
   FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
-  inline void generateInitialPopulation(Hypergraph& hg, Context& context) {
+  /*!
+   * Island model: Each of the num_threads threads evolves its own sub-population
+   * (island) on a private copy of the hypergraph. The population size is split
+   * evenly among the islands. Every migration_interval iterations, each island
+   * sends its best individual to the next island (ring topology), provided that
+   * it improved since the last migration. Each island runs until its thread has
+   * spent time_limit seconds on evolutionary steps. Afterwards, the population
+   * of the island with the best individual becomes the result population.
+   */
+  inline void partitionWithIslands(Hypergraph& hg, Context& context) {
+    const size_t num_islands = context.shared_memory.num_threads;
+    std::vector<std::unique_ptr<Island> > islands;
+    for (size_t i = 0; i < num_islands; ++i) {
+      islands.emplace_back(new Island(hg, context));
+      Context& island_context = islands.back()->context;
+      island_context.shared_memory.num_threads = 1;
+      if (i > 0) {
+        island_context.stats.detachFromParent();
+        island_context.partition.quiet_mode = true;
+        island_context.partition.verbose_output = false;
+        island_context.partition.sp_process_output = false;
+        island_context.initial_partitioning.verbose_output = false;
+      }
+    }
+
+    // Timings of islands running on worker threads are merged into the
+    // timer of the calling thread after all islands finished.
+    std::vector<Timer> island_timers;
+    std::mutex island_timers_mutex;
+
+    parallel::executeConcurrent(num_islands, [&](const size_t island_id) {
+        Island& island = *islands[island_id];
+        // Island 0 runs on the calling thread and continues its seed stream.
+        if (island_id > 0) {
+          Randomize::instance().setSeed(context.partition.seed + static_cast<int>(island_id));
+        }
+        generateInitialPopulation(island.hypergraph, island.context, island.population,
+                                  num_islands);
+
+        Island& neighbor = *islands[(island_id + 1) % num_islands];
+        size_t generation = 0;
+        while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
+          ++island.context.evolutionary.iteration;
+          receiveImmigrants(island);
+
+          if (island.context.evolutionary.diversify_interval != -1 &&
+              island.context.evolutionary.iteration %
+              island.context.evolutionary.diversify_interval == 0) {
+            kahypar::partition::diversify(island.context);
+          }
+
+          performEvolutionaryStep(island.hypergraph, island.context, island.population);
+
+          if (++generation % island.context.evolutionary.migration_interval == 0) {
+            emigrate(island, neighbor);
+          }
+        }
+
+        if (island_id > 0) {
+          std::lock_guard<std::mutex> lock(island_timers_mutex);
+          island_timers.push_back(Timer::instance());
+          Timer::instance().clear();
+        }
+      });
+
+    for (const Timer& timer : island_timers) {
+      Timer::instance().merge(timer);
+    }
+
+    size_t best_island = 0;
+    context.evolutionary.iteration = 0;
+    for (size_t i = 0; i < num_islands; ++i) {
+      context.evolutionary.iteration += islands[i]->context.evolutionary.iteration;
+      if (islands[i]->population.bestFitness() <
+          islands[best_island]->population.bestFitness()) {
+        best_island = i;
+      }
+    }
+    context.evolutionary.population_size = islands[0]->context.evolutionary.population_size;
+    context.evolutionary.edge_frequency_amount =
+      islands[0]->context.evolutionary.edge_frequency_amount;
+    _population = std::move(islands[best_island]->population);
+
+    // Only the private contexts of the islands have been set up so far,
+    // but the final output needs the part weights.
+    context.setupPartWeights(hg.totalWeight());
+    hg.reset();
+    hg.setPartition(_population.individualAt(_population.best()).partition());
+  }
+
+  inline void emigrate(Island& island, Island& neighbor) {
+    if (island.population.size() == 0) {
+      return;
+    }
+    const Individual& best = island.population.individualAt(island.population.best());
+    if (best.fitness() >= island.last_emigrant_fitness) {
+      return;
+    }
+    island.last_emigrant_fitness = best.fitness();
+    DBG << "Emigrating individual" << V(best.fitness());
+    std::lock_guard<std::mutex> lock(neighbor.inbox_mutex);
+    neighbor.inbox.push_back(best.partition());
+  }
+
+  inline void receiveImmigrants(Island& island) {
+    std::vector<std::vector<PartitionID> > immigrants;
+    {
+      std::lock_guard<std::mutex> lock(island.inbox_mutex);
+      immigrants.swap(island.inbox);
+    }
+    for (const std::vector<PartitionID>& partition : immigrants) {
+      island.hypergraph.reset();
+      island.hypergraph.setPartition(partition);
+      Individual immigrant(island.hypergraph, island.context);
+      DBG << "Receiving immigrant" << V(immigrant.fitness());
+      island.population.insert(std::move(immigrant), island.context);
+    }
+  }
+
+  inline void performEvolutionaryStep(Hypergraph& hg, Context& context, Population& population) {
+    EvoDecision decision = decideNextMove(context);
+    DBG << V(decision);
+    switch (decision) {
+      case EvoDecision::mutation:
+        performMutation(hg, context, population);
+        DBG << population;
+        break;
+      case EvoDecision::combine:
+        performCombine(hg, context, population);
+        DBG << population;
+        break;
+      default:
+        LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
+        std::exit(EXIT_FAILURE);
+    }
+  }
+
+  inline void generateInitialPopulation(Hypergraph& hg, Context& context,
+                                        Population& population, const size_t num_islands) {
     // INITIAL POPULATION
     if (context.evolutionary.dynamic_population_size) {
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-      _population.generateIndividual(hg, context);
+      population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       Timer::instance().add(context, Timepoint::evolutionary,
                             std::chrono::duration<double>(end - start).count());
@@ -110,22 +264,28 @@ class EvoPartitioner {
 
       context.evolutionary.population_size = std::min(minimal_size, 50);
       DBG << context.evolutionary.population_size;
-      DBG << _population;
+      DBG << population;
+    }
+    if (num_islands > 1) {
+      // Each island evolves its share of the population.
+      context.evolutionary.population_size =
+        std::max((context.evolutionary.population_size + num_islands - 1) / num_islands,
+                 static_cast<size_t>(3));
     }
     context.evolutionary.edge_frequency_amount = sqrt(context.evolutionary.population_size);
     DBG << "EDGE-FREQUENCY-AMOUNT";
     DBG << context.evolutionary.edge_frequency_amount;
-    while (_population.size() < context.evolutionary.population_size &&
+    while (population.size() < context.evolutionary.population_size &&
            Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
       ++context.evolutionary.iteration;
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-      _population.generateIndividual(hg, context);
+      population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       Timer::instance().add(context, Timepoint::evolutionary,
                             std::chrono::duration<double>(end - start).count());
       io::serializer::serializeEvolutionary(context, hg);
-      verbose(context, 0);
-      DBG << _population;
+      verbose(context, population, 0);
+      DBG << population;
     }
   }
 
@@ -138,18 +298,19 @@ class EvoPartitioner {
   }
 
 
-  inline void performCombine(Hypergraph& hg, const Context& context) {
+  inline void performCombine(Hypergraph& hg, const Context& context,
+                             Population& population) {
     EvoCombineStrategy original_strategy = context.evolutionary.combine_strategy;
     context.evolutionary.combine_strategy = pick::appropriateCombineStrategy(context);
     switch (context.evolutionary.combine_strategy) {
       case EvoCombineStrategy::basic: {
-          size_t insert_position = _population.insert(combine::usingTournamentSelection(hg, context, _population), context);
-          verbose(context, insert_position);
+          size_t insert_position = population.insert(combine::usingTournamentSelection(hg, context, population), context);
+          verbose(context, population, insert_position);
           break;
         }
       case EvoCombineStrategy::edge_frequency: {
-          size_t insert_position = _population.insert(combine::edgeFrequency(hg, context, _population), context);
-          verbose(context, insert_position);
+          size_t insert_position = population.insert(combine::edgeFrequency(hg, context, population), context);
+          verbose(context, population, insert_position);
           break;
         }
       case EvoCombineStrategy::UNDEFINED:
@@ -163,8 +324,9 @@ class EvoPartitioner {
 
   // REMEMBER: When switching back to calling force inserts, add the position i.e:
   // _population.forceInsertSaveBest(mutate::vCycleWithNewInitialPartitioning(hg, _population,_population.individualAt(mutation_position), context),  mutation_position);
-  inline void performMutation(Hypergraph& hg, const Context& context) {
-    const size_t mutation_position = _population.randomIndividual();
+  inline void performMutation(Hypergraph& hg, const Context& context,
+                              Population& population) {
+    const size_t mutation_position = population.randomIndividual();
     EvoMutateStrategy original_strategy = context.evolutionary.mutate_strategy;
     context.evolutionary.mutate_strategy = pick::appropriateMutateStrategy(context);
     DBG << V(context.evolutionary.mutate_strategy);
@@ -172,16 +334,16 @@ class EvoPartitioner {
     switch (context.evolutionary.mutate_strategy) {
       case EvoMutateStrategy::new_initial_partitioning_vcycle:
 
-        _population.insert(
+        population.insert(
           mutate::vCycleWithNewInitialPartitioning(hg,
-                                                   _population.individualAt(mutation_position),
+                                                   population.individualAt(mutation_position),
                                                    context), context);
-        verbose(context, mutation_position);
+        verbose(context, population, mutation_position);
         break;
       case EvoMutateStrategy::vcycle:
-        _population.insert(
-          mutate::vCycle(hg, _population.individualAt(mutation_position), context), context);
-        verbose(context, mutation_position);
+        population.insert(
+          mutate::vCycle(hg, population.individualAt(mutation_position), context), context);
+        verbose(context, population, mutation_position);
         break;
       case EvoMutateStrategy::UNDEFINED:
         LOG << "Partitioner called without mutation strategy";
@@ -190,33 +352,34 @@ class EvoPartitioner {
     }
     context.evolutionary.mutate_strategy = original_strategy;
   }
-  inline void verbose(const Context& context, size_t position) {
+  inline void verbose(const Context& context, const Population& population,
+                      size_t position) {
     if (!debug) {
       return;
     }
     io::printPopulationBanner(context);
     // LOG << _population.individualAt(_population.worst()).fitness();
     unsigned number_of_digits = 0;
-    unsigned n = _population.individualAt(_population.worst()).fitness();
-    unsigned best = _population.best();
+    unsigned n = population.individualAt(population.worst()).fitness();
+    unsigned best = population.best();
     do {
       ++number_of_digits;
       n /= 10;
     } while (n);
 
-    for (size_t i = 0; i < _population.size(); ++i) {
+    for (size_t i = 0; i < population.size(); ++i) {
       if (i == position) {
-        DBG << ">" << _population.individualAt(i).fitness() << "<";
+        DBG << ">" << population.individualAt(i).fitness() << "<";
       } else if (i == best) {
-        DBG << "(" << _population.individualAt(i).fitness() << ")";
+        DBG << "(" << population.individualAt(i).fitness() << ")";
       } else {
-        DBG << " " << _population.individualAt(i).fitness() << " ";
+        DBG << " " << population.individualAt(i).fitness() << " ";
       }
     }
     DBG << "";
-    for (size_t i = 0; i < _population.size(); ++i) {
+    for (size_t i = 0; i < population.size(); ++i) {
       DBG << " ";
-      DBG << std::setw(number_of_digits) << _population.difference(_population.individualAt(best), i, true);
+      DBG << std::setw(number_of_digits) << population.difference(population.individualAt(best), i, true);
       DBG << " ";
     }
     DBG << "";
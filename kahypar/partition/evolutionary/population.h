@@ -125,7 +125,7 @@ class Population {
 
   inline size_t best() const {
     size_t best_position = std::numeric_limits<size_t>::max();
-    HyperedgeWeight best_fitness = std::numeric_limits<int>::max();
+    HyperedgeWeight best_fitness = std::numeric_limits<HyperedgeWeight>::max();
 
     for (size_t i = 0; i < size(); ++i) {
       const HyperedgeWeight result = _individuals[i].fitness();
@@ -140,7 +140,7 @@ class Population {
   }
   inline HyperedgeWeight bestFitness() const {
     size_t best_position = std::numeric_limits<size_t>::max();
-    HyperedgeWeight best_fitness = std::numeric_limits<int>::max();
+    HyperedgeWeight best_fitness = std::numeric_limits<HyperedgeWeight>::max();
     if (size() == 0) {
       DBG << "SIZE IS 0";
       return best_fitness;
@@ -156,9 +156,9 @@ class Population {
     DBG << V(best_position) << V(best_fitness);
     return best_fitness;
   }
-  inline size_t worst() {
+  inline size_t worst() const {
     size_t worst_position = std::numeric_limits<size_t>::max();
-    HyperedgeWeight worst_fitness = std::numeric_limits<int>::min();
+    HyperedgeWeight worst_fitness = std::numeric_limits<HyperedgeWeight>::min();
     for (size_t i = 0; i < size(); ++i) {
       HyperedgeWeight result = _individuals[i].fitness();
       if (result > worst_fitness) {
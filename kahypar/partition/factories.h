@@ -27,6 +27,7 @@
 #include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/coarsening/lazy_vertex_pair_coarsener.h"
 #include "kahypar/partition/coarsening/ml_coarsener.h"
+#include "kahypar/partition/coarsening/parallel_ml_coarsener.h"
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
@@ -37,6 +38,8 @@
 #include "kahypar/partition/refinement/i_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/parallel_kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 
 namespace kahypar {
@@ -58,6 +61,10 @@ using MLCoarseningDispatcher = meta::StaticMultiDispatchFactory<MLCoarsener,
                                                                 ICoarsener,
                                                                 RatingPolicies>;
 
+using ParallelMLCoarseningDispatcher = meta::StaticMultiDispatchFactory<ParallelMLCoarsener,
+                                                                        ICoarsener,
+                                                                        RatingPolicies>;
+
 using FullCoarseningDispatcher = meta::StaticMultiDispatchFactory<FullVertexPairCoarsener,
                                                                   ICoarsener,
                                                                   RatingPolicies>;
@@ -68,13 +75,21 @@ using LazyCoarseningDispatcher = meta::StaticMultiDispatchFactory<LazyVertexPair
 
 using TwoWayFMFactoryDispatcher = meta::StaticMultiDispatchFactory<TwoWayFMRefiner,
                                                                    IRefiner,
-                                                                   meta::Typelist<StoppingPolicyClasses> >;
+                                                                   meta::Typelist<StoppingPolicyClasses,
+                                                                                  PriorityQueuePolicyClasses> >;
 
 using KWayFMFactoryDispatcher = meta::StaticMultiDispatchFactory<KWayFMRefiner,
                                                                  IRefiner,
-                                                                 meta::Typelist<StoppingPolicyClasses> >;
+                                                                 meta::Typelist<StoppingPolicyClasses,
+                                                                                PriorityQueuePolicyClasses> >;
 
 using KWayKMinusOneFactoryDispatcher = meta::StaticMultiDispatchFactory<KWayKMinusOneRefiner,
                                                                         IRefiner,
-                                                                        meta::Typelist<StoppingPolicyClasses> >;
+                                                                        meta::Typelist<StoppingPolicyClasses,
+                                                                                       PriorityQueuePolicyClasses> >;
+
+using ParallelKWayKMinusOneFactoryDispatcher =
+  meta::StaticMultiDispatchFactory<ParallelKWayKMinusOneRefiner,
+                                   IRefiner,
+                                   meta::Typelist<StoppingPolicyClasses> >;
 }  // namespace kahypar
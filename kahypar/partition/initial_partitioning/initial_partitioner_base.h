@@ -34,6 +34,7 @@
 #include "kahypar/partition/refinement/i_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 
 namespace kahypar {
@@ -175,19 +176,7 @@ class InitialPartitionerBase {
                      _hg, _context));
       }
 
-#ifdef USE_BUCKET_QUEUE
-      HyperedgeID max_degree = 0;
-      for (const HypernodeID& hn : _hg.nodes()) {
-        max_degree = std::max(max_degree, _hg.nodeDegree(hn));
-      }
-      HyperedgeWeight max_he_weight = 0;
-      for (const HyperedgeID& he : _hg.edges()) {
-        max_he_weight = std::max(max_he_weight, _hg.edgeWeight(he));
-      }
-      refiner->initialize(static_cast<HyperedgeWeight>(max_degree * max_he_weight));
-#else
-      refiner->initialize(0);
-#endif
+      refiner->initialize(requiresMaxGain(_context) ? maxGain(_hg) : 0);
 
       std::vector<HypernodeID> refinement_nodes;
       Metrics current_metrics = { metrics::hyperedgeCut(_hg),
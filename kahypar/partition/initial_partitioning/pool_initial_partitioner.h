@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,6 +31,7 @@
 #include "kahypar/partition/initial_partitioning/i_initial_partitioner.h"
 #include "kahypar/partition/initial_partitioning/initial_partitioner_base.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -68,6 +71,53 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     double imbalance;
   };
 
+  // ! Best result of the pool as well as the extreme results of all executed algorithms.
+  class PoolSummary {
+ public:
+    explicit PoolSummary(const Objective obj) :
+      best_cut(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, kInvalidImbalance),
+      min_cut(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, 0.0),
+      max_cut(InitialPartitionerAlgorithm::pool, obj, -1, 0.0),
+      min_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, kInvalidImbalance),
+      max_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, -0.1) { }
+
+    // ! Adds the result of an algorithm and returns true if it is the new best result.
+    bool add(const InitialPartitionerAlgorithm algo, const HyperedgeWeight current_quality,
+             const double current_imbalance, const double epsilon) {
+      const bool improved = isBetterResult(current_quality, current_imbalance, best_cut, epsilon);
+      if (improved) {
+        applyPartitioningResults(best_cut, current_quality, current_imbalance, algo);
+      }
+      if (current_quality < min_cut.quality) {
+        applyPartitioningResults(min_cut, current_quality, current_imbalance, algo);
+      }
+      if (current_quality > max_cut.quality) {
+        applyPartitioningResults(max_cut, current_quality, current_imbalance, algo);
+      }
+      if (current_imbalance < min_imbalance.imbalance) {
+        applyPartitioningResults(min_imbalance, current_quality, current_imbalance, algo);
+      }
+      if (current_imbalance > max_imbalance.imbalance) {
+        applyPartitioningResults(max_imbalance, current_quality, current_imbalance, algo);
+      }
+      return improved;
+    }
+
+    void print() const {
+      min_cut.print_result("Minimum Quality  ");
+      max_cut.print_result("Maximum Quality  ");
+      min_imbalance.print_result("Minimum Imbalance");
+      max_imbalance.print_result("Maximum Imbalance");
+      best_cut.print_result("==> Best Quality ");
+    }
+
+    PartitioningResult best_cut;
+    PartitioningResult min_cut;
+    PartitioningResult max_cut;
+    PartitioningResult min_imbalance;
+    PartitioningResult max_imbalance;
+  };
+
  public:
   PoolInitialPartitioner(Hypergraph& hypergraph, Context& context) :
     Base(hypergraph, context),
@@ -105,19 +155,120 @@ class PoolInitialPartitioner : public IInitialPartitioner,
 
  private:
   void partitionImpl() override final {
-    Base::multipleRunsInitialPartitioning();
+    if (_context.shared_memory.parallel_initial_partitioning_pool && !_hg.isModified()) {
+      parallelInitialPartition();
+    } else {
+      Base::multipleRunsInitialPartitioning();
+    }
   }
 
   void initialPartition() {
-    Objective obj = _context.partition.objective;
-    PartitioningResult best_cut(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, kInvalidImbalance);
-    PartitioningResult min_cut(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, 0.0);
-    PartitioningResult max_cut(InitialPartitionerAlgorithm::pool, obj, -1, 0.0);
-    PartitioningResult min_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut,
-                                     kInvalidImbalance);
-    PartitioningResult max_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, -0.1);
+    PoolSummary summary(_context.partition.objective);
+    std::vector<PartitionID> best_partition(_hg.initialNumNodes());
+    for (const InitialPartitionerAlgorithm algo : enabledAlgorithms()) {
+      std::unique_ptr<IInitialPartitioner> partitioner(
+        InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
+      partitioner->partition();
+      const HyperedgeWeight current_quality = quality(_hg);
+      const double current_imbalance = metrics::imbalance(_hg, _context);
+      DBG << algo << V(_context.partition.objective) << V(current_quality) << V(current_imbalance);
+
+      if (summary.add(algo, current_quality, current_imbalance, _context.partition.epsilon)) {
+        for (const HypernodeID& hn : _hg.nodes()) {
+          best_partition[hn] = _hg.partID(hn);
+        }
+      }
+    }
+    applyBestPartition(summary, best_partition);
+  }
 
+  /*!
+   * Parallel version of initialPartition(): Each run of each enabled algorithm
+   * is executed as a separate job with its own seed. Each worker thread owns a
+   * private copy of the coarse hypergraph. The jobs are processed in rounds of
+   * num_threads jobs. After each round, the results are evaluated in the same
+   * order and with the same rules as in the sequential version, i.e., the best
+   * of the nruns runs of each algorithm is compared to the best partition of all
+   * previous algorithms. Thus, the result does not depend on the number of threads.
+   */
+  void parallelInitialPartition() {
+    const std::vector<InitialPartitionerAlgorithm> algorithms = enabledAlgorithms();
+    const size_t nruns = std::max(_context.initial_partitioning.nruns, static_cast<uint32_t>(1));
+    const size_t num_jobs = algorithms.size() * nruns;
+    const size_t num_threads = std::max(std::min(_context.shared_memory.num_threads, num_jobs),
+                                        static_cast<size_t>(1));
+    const Objective obj = _context.partition.objective;
+
+    std::vector<Hypergraph> hypergraphs;
+    hypergraphs.reserve(num_threads);
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+      hypergraphs.emplace_back(ds::copyHypergraph(_hg));
+    }
+    std::vector<std::vector<PartitionID> > job_partitions(
+      num_threads, std::vector<PartitionID>(_hg.initialNumNodes()));
+    std::vector<PartitioningResult> job_results(
+      num_threads, PartitioningResult(InitialPartitionerAlgorithm::pool, obj, kInvalidCut,
+                                      kInvalidImbalance));
+
+    PoolSummary summary(obj);
     std::vector<PartitionID> best_partition(_hg.initialNumNodes());
+    PartitioningResult best_run(InitialPartitionerAlgorithm::pool, obj, kInvalidCut,
+                                kInvalidImbalance);
+    std::vector<PartitionID> best_run_partition(_hg.initialNumNodes());
+
+    const int seed = Randomize::instance().newRandomSeed();
+    const int continuation_seed = Randomize::instance().newRandomSeed();
+    for (size_t first_job = 0; first_job < num_jobs; first_job += num_threads) {
+      const size_t round_size = std::min(num_threads, num_jobs - first_job);
+      parallel::executeConcurrent(round_size, [&](const size_t thread_id) {
+          const size_t job = first_job + thread_id;
+          const InitialPartitionerAlgorithm algo = algorithms[job / nruns];
+          Randomize::instance().setSeed(seed + static_cast<int>(job));
+
+          Context job_context(_context);
+          job_context.stats.detachFromParent();
+          job_context.initial_partitioning.nruns = 1;
+          Hypergraph& hypergraph = hypergraphs[thread_id];
+          std::unique_ptr<IInitialPartitioner> partitioner(
+            InitialPartitioningFactory::getInstance().createObject(algo, hypergraph, job_context));
+          partitioner->partition();
+
+          job_results[thread_id] = PartitioningResult(algo, obj, quality(hypergraph),
+                                                      metrics::imbalance(hypergraph, job_context));
+          for (const HypernodeID& hn : hypergraph.nodes()) {
+            job_partitions[thread_id][hn] = hypergraph.partID(hn);
+          }
+        });
+
+      for (size_t thread_id = 0; thread_id < round_size; ++thread_id) {
+        const size_t job = first_job + thread_id;
+        const PartitioningResult& result = job_results[thread_id];
+        if (job % nruns == 0) {
+          best_run.quality = kInvalidCut;
+          best_run.imbalance = kInvalidImbalance;
+        }
+        if (isBetterResult(result.quality, result.imbalance, best_run,
+                           _context.partition.epsilon)) {
+          applyPartitioningResults(best_run, result.quality, result.imbalance, result.algo);
+          best_run_partition = job_partitions[thread_id];
+        }
+        if (job % nruns == nruns - 1) {
+          DBG << best_run.algo << V(obj) << V(best_run.quality) << V(best_run.imbalance);
+          if (summary.add(best_run.algo, best_run.quality, best_run.imbalance,
+                          _context.partition.epsilon)) {
+            best_partition = best_run_partition;
+          }
+        }
+      }
+    }
+    Randomize::instance().setSeed(continuation_seed);
+
+    applyBestPartition(summary, best_partition);
+  }
+
+  // ! Returns the enabled algorithms of the pool in the order in which they are executed.
+  std::vector<InitialPartitionerAlgorithm> enabledAlgorithms() const {
+    std::vector<InitialPartitionerAlgorithm> algorithms;
     unsigned int n = _partitioner_pool.size() - 1;
     for (unsigned int i = 0; i <= n; ++i) {
       // If the (n-i)th bit of pool_type is set we execute the corresponding
@@ -132,51 +283,22 @@ class PoolInitialPartitioner : public IInitialPartitioner,
         DBG << "skipping maxpin";
         continue;
       }
-      std::unique_ptr<IInitialPartitioner> partitioner(
-        InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
-      partitioner->partition();
-      HyperedgeWeight current_quality = obj == Objective::cut ?
-                                        metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
-      double current_imbalance = metrics::imbalance(_hg, _context);
-      DBG << algo << V(obj) << V(current_quality) << V(current_imbalance);
-
-      const bool equal_metric = current_quality == best_cut.quality;
-      const bool improved_metric = current_quality < best_cut.quality;
-      const bool improved_imbalance = current_imbalance < best_cut.imbalance;
-      const bool is_feasible_partition = current_imbalance <= _context.partition.epsilon;
-      const bool is_best_cut_feasible_paritition = best_cut.imbalance <= _context.partition.epsilon;
-
-      if ((improved_metric && (is_feasible_partition || improved_imbalance)) ||
-          (equal_metric && improved_imbalance) ||
-          (is_feasible_partition && !is_best_cut_feasible_paritition)) {
-        for (const HypernodeID& hn : _hg.nodes()) {
-          best_partition[hn] = _hg.partID(hn);
-        }
-        applyPartitioningResults(best_cut, current_quality, current_imbalance, algo);
-      }
-      if (current_quality < min_cut.quality) {
-        applyPartitioningResults(min_cut, current_quality, current_imbalance, algo);
-      }
-      if (current_quality > max_cut.quality) {
-        applyPartitioningResults(max_cut, current_quality, current_imbalance, algo);
-      }
-      if (current_imbalance < min_imbalance.imbalance) {
-        applyPartitioningResults(min_imbalance, current_quality, current_imbalance, algo);
-      }
-      if (current_imbalance > max_imbalance.imbalance) {
-        applyPartitioningResults(max_imbalance, current_quality, current_imbalance, algo);
-      }
+      algorithms.push_back(algo);
     }
+    return algorithms;
+  }
 
+  HyperedgeWeight quality(const Hypergraph& hypergraph) const {
+    return _context.partition.objective == Objective::cut ?
+           metrics::hyperedgeCut(hypergraph) : metrics::km1(hypergraph);
+  }
+
+  void applyBestPartition(const PoolSummary& summary,
+                          const std::vector<PartitionID>& best_partition) {
     if (_context.initial_partitioning.verbose_output) {
-      min_cut.print_result("Minimum Quality  ");
-      max_cut.print_result("Maximum Quality  ");
-      min_imbalance.print_result("Minimum Imbalance");
-      max_imbalance.print_result("Maximum Imbalance");
-      best_cut.print_result("==> Best Quality ");
+      summary.print();
     }
 
-
     const PartitionID unassigned_part = _context.initial_partitioning.unassigned_part;
     _context.initial_partitioning.unassigned_part = -1;
     Base::resetPartitioning();
@@ -204,9 +326,22 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     _context.initial_partitioning.nruns = 1;
   }
 
-  void applyPartitioningResults(PartitioningResult& result, const HyperedgeWeight quality,
-                                const double imbalance,
-                                const InitialPartitionerAlgorithm algo) const {
+  static bool isBetterResult(const HyperedgeWeight current_quality, const double current_imbalance,
+                             const PartitioningResult& best, const double epsilon) {
+    const bool equal_metric = current_quality == best.quality;
+    const bool improved_metric = current_quality < best.quality;
+    const bool improved_imbalance = current_imbalance < best.imbalance;
+    const bool is_feasible_partition = current_imbalance <= epsilon;
+    const bool is_best_cut_feasible_paritition = best.imbalance <= epsilon;
+
+    return (improved_metric && (is_feasible_partition || improved_imbalance)) ||
+           (equal_metric && improved_imbalance) ||
+           (is_feasible_partition && !is_best_cut_feasible_paritition);
+  }
+
+  static void applyPartitioningResults(PartitioningResult& result, const HyperedgeWeight quality,
+                                       const double imbalance,
+                                       const InitialPartitionerAlgorithm algo) {
     result.quality = quality;
     result.imbalance = imbalance;
     result.algo = algo;
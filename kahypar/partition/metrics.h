@@ -23,6 +23,7 @@
 #include <cmath>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -172,6 +173,80 @@ static inline double imbalance(const Hypergraph& hypergraph, const Context& cont
   return max_balance - 1.0;
 }
 
+// Maintains the imbalance of a partition incrementally. The relative weights
+// partWeight(i) / perfect_balance_part_weights[i] of all blocks are stored in the
+// leaves of a max tournament tree. After a hypernode moved, only the leaves of the
+// source and target block and their ancestors have to be updated, i.e., a move
+// costs O(log k) instead of the O(k) needed by imbalance(hypergraph, context).
+// The tracked imbalance is exactly equal to imbalance(hypergraph, context).
+class ImbalanceTracker {
+ public:
+  ImbalanceTracker(const Hypergraph& hypergraph, const Context& context) :
+    _hg(hypergraph),
+    _context(context),
+    _num_leaves(0),
+    _tree() { }
+
+  ImbalanceTracker(const ImbalanceTracker&) = delete;
+  ImbalanceTracker& operator= (const ImbalanceTracker&) = delete;
+
+  ImbalanceTracker(ImbalanceTracker&&) = default;
+  ImbalanceTracker& operator= (ImbalanceTracker&&) = delete;
+
+  ~ImbalanceTracker() = default;
+
+  // ! Rebuilds the tree from the current part weights in O(k).
+  void initialize() {
+    ASSERT(!_context.partition.perfect_balance_part_weights.empty());
+    _num_leaves = 1;
+    while (_num_leaves < static_cast<size_t>(_context.partition.k)) {
+      _num_leaves <<= 1;
+    }
+    _tree.assign(2 * _num_leaves, std::numeric_limits<double>::lowest());
+    for (PartitionID part = 0; part < _context.partition.k; ++part) {
+      _tree[_num_leaves + part] = balance(part);
+    }
+    for (size_t i = _num_leaves - 1; i > 0; --i) {
+      _tree[i] = std::max(_tree[2 * i], _tree[2 * i + 1]);
+    }
+  }
+
+  // ! Has to be called for both blocks after a hypernode moved between them.
+  void update(const PartitionID part) {
+    ASSERT(_num_leaves > 0, "ImbalanceTracker is not initialized");
+    ASSERT(part < _context.partition.k, V(part));
+    size_t i = _num_leaves + part;
+    _tree[i] = balance(part);
+    for (i >>= 1; i > 0; i >>= 1) {
+      const double max_balance = std::max(_tree[2 * i], _tree[2 * i + 1]);
+      if (_tree[i] == max_balance) {
+        break;
+      }
+      _tree[i] = max_balance;
+    }
+  }
+
+  void update(const PartitionID from_part, const PartitionID to_part) {
+    update(from_part);
+    update(to_part);
+  }
+
+  double imbalance() const {
+    return _tree[1] - 1.0;
+  }
+
+ private:
+  double balance(const PartitionID part) const {
+    return _hg.partWeight(part) /
+           static_cast<double>(_context.partition.perfect_balance_part_weights[part]);
+  }
+
+  const Hypergraph& _hg;
+  const Context& _context;
+  size_t _num_leaves;
+  std::vector<double> _tree;
+};
+
 inline double imbalanceFixedVertices(const Hypergraph& hypergraph, const PartitionID k) {
   HypernodeWeight max_weight = hypergraph.fixedVertexPartWeight(0);
   for (PartitionID i = 1; i != k; ++i) {
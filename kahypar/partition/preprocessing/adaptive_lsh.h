@@ -30,6 +30,7 @@
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/datastructure/hash_table.h"
 #include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
 #include "kahypar/utils/hash_vector.h"
 
 namespace kahypar {
@@ -37,6 +38,8 @@ template <typename _HashPolicy>
 class AdaptiveLSHWithConnectedComponents {
  private:
   static constexpr bool debug = false;
+  // Minimum number of vertices per thread for which min-hashes are calculated in parallel
+  static constexpr size_t kMinVerticesPerThread = 1024;
 
   using HashPolicy = _HashPolicy;
   using BaseHashPolicy = typename HashPolicy::BaseHashPolicy;
@@ -152,6 +155,14 @@ class AdaptiveLSHWithConnectedComponents {
   }
 
  private:
+  size_t numThreads(const size_t num_vertices) const {
+    if (!_context.shared_memory.parallel_min_hash_sparsifier) {
+      return 1;
+    }
+    return std::max(std::min(_context.shared_memory.num_threads,
+                             num_vertices / kMinVerticesPerThread), static_cast<size_t>(1));
+  }
+
   void incrementalParametersEstimation(std::vector<HypernodeID>& active_vertices,
                                        const uint32_t seed, MyHashSet& main_hash_set,
                                        const uint32_t main_hash_num) {
@@ -179,12 +190,14 @@ class AdaptiveLSHWithConnectedComponents {
     for (size_t i = 0; i + 1 < min_hash_num; ++i) {
       _hash_set.addHashVector();
       _base_hash_policy.addHashFunction(rnd(eng));
+    }
+    _base_hash_policy.calculateLastHashes(_hypergraph, active_vertices.cbegin(),
+                                          active_vertices.cend(), min_hash_num - 1, _hash_set,
+                                          numThreads(active_vertices.size()));
 
-      _base_hash_policy.calculateLastHash(_hypergraph, active_vertices, _hash_set);
-
-      const uint32_t last_hash = _hash_set.getHashNum() - 1;
-      for (const auto& ver : active_vertices) {
-        _hashes[ver] ^= _hash_set[last_hash][ver];
+    for (const auto& ver : active_vertices) {
+      for (uint32_t hash = 0; hash + 1 < min_hash_num; ++hash) {
+        _hashes[ver] ^= _hash_set[hash][ver];
       }
     }
 
@@ -199,6 +212,13 @@ class AdaptiveLSHWithConnectedComponents {
 
       const uint32_t last_hash = _hash_set.getHashNum() - 1;
 
+      _vertices.clear();
+      for (const Pair& bucket_entry : _buckets) {
+        _vertices.push_back(bucket_entry.second);
+      }
+      _base_hash_policy.calculateLastHashes(_hypergraph, _vertices.cbegin(), _vertices.cend(),
+                                            1, _hash_set, numThreads(_vertices.size()));
+
       // Decide for which vertices we continue to increase the number of hash functions
       _new_buckets.clear();
 
@@ -215,8 +235,6 @@ class AdaptiveLSHWithConnectedComponents {
           _vertices.push_back(it->second);
         }
 
-        _base_hash_policy.calculateLastHash(_hypergraph, _vertices, _hash_set);
-
         if (_vertices.size() == 1) {
           --remained_vertices;
           const HashValue hash = _hash_set[last_hash][_vertices.front()];
@@ -45,20 +45,24 @@ class HypergraphDeduplicator {
 
   ~HypergraphDeduplicator() = default;
 
-  void removeParallelHyperedges(Hypergraph& hypergraph) {
-    _removed_parallel_hes = std::move(kahypar::ds::removeParallelHyperedges(hypergraph));
+  void removeParallelHyperedges(Hypergraph& hypergraph, const size_t num_threads = 1) {
+    _removed_parallel_hes = std::move(kahypar::ds::removeParallelHyperedges(hypergraph,
+                                                                             num_threads));
   }
 
-  void removeIdenticalVertices(Hypergraph& hypergraph) {
-    _removed_identical_nodes = std::move(kahypar::ds::removeIdenticalNodes(hypergraph));
+  void removeIdenticalVertices(Hypergraph& hypergraph, const size_t num_threads = 1) {
+    _removed_identical_nodes = std::move(kahypar::ds::removeIdenticalNodes(hypergraph,
+                                                                           num_threads));
   }
 
   void deduplicate(Hypergraph& hypergraph, const Context& context) {
     if (context.partition.verbose_output) {
       LOG << "Performing deduplication:";
     }
-    removeIdenticalVertices(hypergraph);
-    removeParallelHyperedges(hypergraph);
+    const size_t num_threads = context.shared_memory.parallel_deduplication ?
+                               context.shared_memory.num_threads : 1;
+    removeIdenticalVertices(hypergraph, num_threads);
+    removeParallelHyperedges(hypergraph, num_threads);
     if (context.partition.verbose_output) {
       LOG << "  # removed parallel hyperedges =" << _removed_parallel_hes.size() << " ";
       LOG << "  # removed identical vertices  =" << _removed_identical_nodes.size() << " ";
@@ -22,15 +22,20 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <vector>
 
 #include "kahypar/datastructure/graph.h"
+#include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/preprocessing/modularity.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/stats.h"
 #include "kahypar/utils/timer.h"
@@ -113,7 +118,7 @@ class Louvain {
         cur_quality = quality.quality();
         DBG << "Starting Contraction of communities...";
         start = std::chrono::high_resolution_clock::now();
-        auto contraction = _graph_hierarchy[cur_idx++].contractClusters();
+        auto contraction = _graph_hierarchy[cur_idx++].contractClusters(numThreads());
         end = std::chrono::high_resolution_clock::now();
         elapsed_seconds = end - start;
         DBG << "Contraction Time:" << elapsed_seconds.count() << "s";
@@ -157,6 +162,7 @@ class Louvain {
 
  private:
   FRIEND_TEST(ALouvainAlgorithm, DoesOneLouvainPass);
+  FRIEND_TEST(ALouvainAlgorithm, DoesOneParallelLouvainPass);
   FRIEND_TEST(ALouvainAlgorithm, AssingsMappingToNextLevelFinerGraph);
   FRIEND_TEST(ALouvainKarateClub, DoesLouvainAlgorithm);
 
@@ -167,10 +173,12 @@ class Louvain {
     }
   }
 
-  EdgeWeight louvain_pass(Graph& graph, QualityMeasure& quality) {
-    size_t node_moves = 0;
-    uint32_t iterations = 0;
+  size_t numThreads() const {
+    return _context.shared_memory.parallel_community_detection ?
+           std::max(_context.shared_memory.num_threads, static_cast<size_t>(1)) : 1;
+  }
 
+  void computeNodeOrder(const Graph& graph) {
     _random_node_order.clear();
     for (const NodeID& node : graph.nodes()) {
       _random_node_order.push_back(node);
@@ -180,6 +188,17 @@ class Louvain {
     if (RandomizeNodes) {
       Randomize::instance().shuffleVector(_random_node_order, _random_node_order.size());
     }
+  }
+
+  EdgeWeight louvain_pass(Graph& graph, QualityMeasure& quality) {
+    if (_context.shared_memory.parallel_community_detection) {
+      return parallelLouvainPass(graph, quality);
+    }
+
+    size_t node_moves = 0;
+    uint32_t iterations = 0;
+
+    computeNodeOrder(graph);
 
     // PERFORMANCE TUNING:
     // A node can only change its cluster if some of its incident clusters
@@ -204,16 +223,16 @@ class Louvain {
         EdgeWeight best_gain = 0.0L;
 
         bool incident_cluster_changed = false;
-        for (const Edge& e : graph.incidentEdges(node)) {
-          const NodeID v = e.target_node;
-          const ClusterID v_cid = graph.clusterID(v);
-          if (v_cid == cur_cid && v != node) {
-            cur_incident_cluster_weight += e.weight;
-          }
-          if (node_time_stamp[node] < cluster_time_stamp[v_cid]) {
-            incident_cluster_changed = true;
-          }
-        }
+        graph.forEachIncidentEdge(node, [&](const Edge& e) {
+            const NodeID v = e.target_node;
+            const ClusterID v_cid = graph.clusterID(v);
+            if (v_cid == cur_cid && v != node) {
+              cur_incident_cluster_weight += e.weight;
+            }
+            if (node_time_stamp[node] < cluster_time_stamp[v_cid]) {
+              incident_cluster_changed = true;
+            }
+          });
         best_incident_cluster_weight = cur_incident_cluster_weight;
 
         if (incident_cluster_changed) {
@@ -249,6 +268,182 @@ class Louvain {
     return quality.quality();
   }
 
+  // Synchronous version of louvain_pass: The random node order is split into
+  // kNumSubRounds sub-rounds. In each sub-round, all nodes of the sub-round first
+  // compute their best move concurrently based on the clustering at the beginning
+  // of the sub-round. Afterwards, the moves are applied: cluster sizes, time stamps
+  // and cluster IDs concurrently, but the cluster volumes sequentially in node order.
+  // Atomic floating point additions would make the volumes depend on the order in
+  // which the threads apply the moves, since floating point additions are not
+  // associative. This way, the resulting clustering is independent of the number
+  // of threads.
+  //
+  // In contrast to louvain_pass, the pass also stops after the first iteration that
+  // does not improve the quality and restores the clustering before that iteration
+  // (see below).
+  EdgeWeight parallelLouvainPass(Graph& graph, QualityMeasure& quality) {
+    const size_t num_nodes = graph.numNodes();
+    const size_t num_threads = numThreads();
+    size_t node_moves = 0;
+    uint32_t iterations = 0;
+
+    computeNodeOrder(graph);
+
+    std::vector<ClusterID> cluster(num_nodes);
+    std::vector<ClusterID> target_cluster(num_nodes);
+    std::vector<EdgeWeight> cluster_volume(num_nodes);
+    std::vector<std::atomic<NodeID> > cluster_size(num_nodes);
+    std::vector<size_t> node_time_stamp(num_nodes, 0);
+    std::vector<std::atomic<size_t> > cluster_time_stamp(num_nodes);
+    std::vector<size_t> thread_node_moves(num_threads, 0);
+    std::vector<std::unique_ptr<ds::SparseMap<ClusterID, EdgeWeight> > >
+    incident_cluster_weight(num_threads);
+
+    parallel::executeConcurrent(num_threads, [&](const size_t thread_id) {
+        incident_cluster_weight[thread_id] =
+          std::make_unique<ds::SparseMap<ClusterID, EdgeWeight> >(num_nodes);
+      });
+    parallel::parallelFor(0, num_nodes, num_threads, [&](const size_t node) {
+        ASSERT(static_cast<size_t>(graph.clusterID(node)) == node);
+        cluster[node] = graph.clusterID(node);
+        cluster_volume[node] = graph.weightedDegree(node);
+        cluster_size[node].store(1, std::memory_order_relaxed);
+        cluster_time_stamp[node].store(1, std::memory_order_relaxed);
+      });
+
+    // Same performance tuning as in louvain_pass: A node is only evaluated if one of
+    // its incident clusters changed since the node was evaluated for the last time.
+    // Moves of sub-round i mark the affected clusters with time stamp i + 1.
+    size_t time_stamp = 1;
+
+    // Concurrent moves can cancel each other out such that some nodes move back and
+    // forth forever. Thus, the pass also stops as soon as an iteration does not improve
+    // the quality. In that case, the clustering of the previous iteration is restored.
+    EdgeWeight cur_quality = quality.quality();
+    bool improvement = false;
+    std::vector<ClusterID> previous_cluster;
+
+    do {
+      ++iterations;
+      DBG << "######## Starting Parallel-Louvain-Pass-Iteration #" << iterations << "########";
+      previous_cluster = cluster;
+      std::fill(thread_node_moves.begin(), thread_node_moves.end(), 0);
+      for (size_t sub_round = 0; sub_round < kNumSubRounds; ++sub_round, ++time_stamp) {
+        const size_t begin = sub_round * num_nodes / kNumSubRounds;
+        const size_t end = (sub_round + 1) * num_nodes / kNumSubRounds;
+
+        parallel::parallelForBlocks(begin, end, num_threads,
+                                    [&](const size_t thread_id, const size_t block_begin,
+                                        const size_t block_end) {
+            for (size_t i = block_begin; i < block_end; ++i) {
+              const NodeID node = _random_node_order[i];
+              target_cluster[node] = cluster[node];
+              const bool incident_cluster_changed =
+                graph.forEachIncidentEdgeUntil(node, [&](const Edge& e) {
+                    return node_time_stamp[node] <
+                           cluster_time_stamp[cluster[e.target_node]].load(std::memory_order_relaxed);
+                  });
+              if (incident_cluster_changed) {
+                target_cluster[node] = bestCluster(graph, quality, node, cluster, cluster_volume,
+                                                   cluster_size, *incident_cluster_weight[thread_id]);
+              }
+              node_time_stamp[node] = time_stamp;
+            }
+          });
+
+        for (size_t i = begin; i < end; ++i) {
+          const NodeID node = _random_node_order[i];
+          if (cluster[node] != target_cluster[node]) {
+            const EdgeWeight weighted_degree = graph.weightedDegree(node);
+            cluster_volume[cluster[node]] -= weighted_degree;
+            cluster_volume[target_cluster[node]] += weighted_degree;
+          }
+        }
+
+        parallel::parallelForBlocks(begin, end, num_threads,
+                                    [&](const size_t thread_id, const size_t block_begin,
+                                        const size_t block_end) {
+            for (size_t i = block_begin; i < block_end; ++i) {
+              const NodeID node = _random_node_order[i];
+              const ClusterID from = cluster[node];
+              const ClusterID to = target_cluster[node];
+              if (from != to) {
+                cluster_size[from].fetch_sub(1, std::memory_order_relaxed);
+                cluster_size[to].fetch_add(1, std::memory_order_relaxed);
+                cluster_time_stamp[from].store(time_stamp + 1, std::memory_order_relaxed);
+                cluster_time_stamp[to].store(time_stamp + 1, std::memory_order_relaxed);
+                cluster[node] = to;
+                ++thread_node_moves[thread_id];
+              }
+            }
+          });
+      }
+      node_moves = std::accumulate(thread_node_moves.begin(), thread_node_moves.end(),
+                                   static_cast<size_t>(0));
+
+      DBG << "Iteration #" << iterations << ": Moving" << node_moves << "nodes to new communities.";
+
+      graph.setClusterIDs(cluster);
+      quality.recompute(num_threads);
+      const EdgeWeight new_quality = quality.quality();
+      improvement = new_quality > cur_quality;
+      if (improvement) {
+        cur_quality = new_quality;
+      } else if (node_moves > 0) {
+        DBG << "Iteration #" << iterations << "did not improve quality, restoring previous clustering.";
+        graph.setClusterIDs(previous_cluster);
+        quality.recompute(num_threads);
+      }
+    } while (node_moves > 0 && improvement &&
+             iterations < _context.preprocessing.community_detection.max_pass_iterations);
+
+    return quality.quality();
+  }
+
+  // Returns the cluster to which node should be moved (or its current cluster),
+  // where the gains are computed exactly as in louvain_pass. A node of a singleton
+  // cluster is only moved to another singleton cluster with smaller ID. Otherwise,
+  // two singleton nodes could swap their clusters in every sub-round.
+  ClusterID bestCluster(const Graph& graph, const QualityMeasure& quality, const NodeID node,
+                        const std::vector<ClusterID>& cluster,
+                        const std::vector<EdgeWeight>& cluster_volume,
+                        const std::vector<std::atomic<NodeID> >& cluster_size,
+                        ds::SparseMap<ClusterID, EdgeWeight>& incident_cluster_weight) const {
+    const ClusterID cur_cid = cluster[node];
+    const bool is_singleton = cluster_size[cur_cid].load(std::memory_order_relaxed) == 1;
+    incident_cluster_weight.clear();
+    incident_cluster_weight[cur_cid] = 0.0L;
+    graph.forEachIncidentEdge(node, [&](const Edge& e) {
+        if (e.target_node != node) {
+          incident_cluster_weight[cluster[e.target_node]] += e.weight;
+        }
+      });
+
+    ClusterID best_cid = cur_cid;
+    EdgeWeight best_gain = 0.0L;
+    for (const auto& incident_cluster : incident_cluster_weight) {
+      const ClusterID cid = incident_cluster.key;
+      if (is_singleton && cid > cur_cid &&
+          cluster_size[cid].load(std::memory_order_relaxed) == 1) {
+        continue;
+      }
+      EdgeWeight volume = cluster_volume[cid];
+      if (cid == cur_cid) {
+        volume -= graph.weightedDegree(node);
+      }
+      const EdgeWeight gain = quality.gain(node, volume, incident_cluster.value);
+      if (gain > best_gain) {
+        best_gain = gain;
+        best_cid = cid;
+      }
+    }
+    return best_cid;
+  }
+
+  // Number of synchronous sub-rounds per iteration of parallelLouvainPass. Fewer
+  // nodes per sub-round reduce the number of conflicting concurrent moves.
+  static constexpr size_t kNumSubRounds = 16;
+
   std::vector<Graph> _graph_hierarchy;
   std::vector<NodeID> _random_node_order;
   const Context& _context;
@@ -29,6 +29,7 @@
 #include "kahypar/datastructure/graph.h"
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
+#include "kahypar/utils/parallel.h"
 
 namespace kahypar {
 
@@ -106,6 +107,36 @@ class Modularity {
     return gain;
   }
 
+  // Gain of inserting node into a community with total weight community_weight
+  // without node. Does not access the clustering and can be used concurrently.
+  EdgeWeight gain(const NodeID node, const EdgeWeight community_weight,
+                  const EdgeWeight incident_community_weight) const {
+    ASSERT(node < _graph.numNodes(), "NodeID" << node << "doesn't exist!");
+    return incident_community_weight -
+           community_weight * _graph.weightedDegree(node) / _graph.totalWeight();
+  }
+
+  // Recomputes the community weights after the clustering of the graph was
+  // changed without remove/insert (e.g., by parallel local moving).
+  void recompute(const size_t num_threads) {
+    std::vector<EdgeWeight> node_internal_weight(_graph.numNodes(), 0.0L);
+    parallel::parallelFor(0, _graph.numNodes(), num_threads, [&](const size_t node) {
+        const ClusterID cid = _graph.clusterID(node);
+        _graph.forEachIncidentEdge(node, [&](const Edge& e) {
+            if (_graph.clusterID(e.target_node) == cid) {
+              node_internal_weight[node] += e.weight;
+            }
+          });
+      });
+
+    std::fill(_internal_weight.begin(), _internal_weight.end(), 0.0L);
+    std::fill(_total_weight.begin(), _total_weight.end(), 0.0L);
+    for (const NodeID& node : _graph.nodes()) {
+      const ClusterID cid = _graph.clusterID(node);
+      _internal_weight[cid] += node_internal_weight[node];
+      _total_weight[cid] += _graph.weightedDegree(node);
+    }
+  }
 
   EdgeWeight quality() {
     EdgeWeight q = 0.0L;
@@ -136,13 +167,13 @@ class Modularity {
     const EdgeWeight m2 = std::max(_graph.totalWeight(), static_cast<EdgeWeight>(1));
 
     for (const NodeID& u : _graph.nodes()) {
-      for (const Edge& edge : _graph.incidentEdges(u)) {
-        const NodeID v = edge.target_node;
-        _vis.set(v, true);
-        if (_graph.clusterID(u) == _graph.clusterID(v)) {
-          q += edge.weight - (_graph.weightedDegree(u) * _graph.weightedDegree(v)) / m2;
-        }
-      }
+      _graph.forEachIncidentEdge(u, [&](const Edge& edge) {
+          const NodeID v = edge.target_node;
+          _vis.set(v, true);
+          if (_graph.clusterID(u) == _graph.clusterID(v)) {
+            q += edge.weight - (_graph.weightedDegree(u) * _graph.weightedDegree(v)) / m2;
+          }
+        });
       for (const NodeID& v : _graph.nodes()) {
         if (_graph.clusterID(u) == _graph.clusterID(v) && !_vis[v]) {
           q -= (_graph.weightedDegree(u) * _graph.weightedDegree(v)) / m2;
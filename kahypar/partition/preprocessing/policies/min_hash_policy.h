@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "kahypar/utils/hash_vector.h"
+#include "kahypar/utils/parallel.h"
 
 namespace kahypar {
 template <typename _HashFunc>
@@ -36,6 +37,10 @@ class MinHashPolicy {
   using MyHashSet = HashStorage<HashValue>;
   using VertexSet = std::vector<VertexId>;
 
+  // Number of hash functions that are evaluated together in one pass over
+  // the incident hyperedges of a vertex.
+  static constexpr size_t kHashBlockSize = 8;
+
   explicit MinHashPolicy(const uint32_t hash_num = 0, const uint32_t seed = 0) :
     _dim(hash_num),
     _seed(seed),
@@ -55,41 +60,48 @@ class MinHashPolicy {
 
   // calculates minHashes for vertices in [begin, end)
   void operator() (const Hypergraph& graph, const VertexId begin, const VertexId end,
-                   MyHashSet& hash_set) const {
+                   MyHashSet& hash_set, const size_t num_threads = 1) const {
     ALWAYS_ASSERT(getHashNum() > 0, "The number of hashes should be greater than zero");
-    for (auto vertex_id = begin; vertex_id != end; ++vertex_id) {
-      for (uint32_t hash_num = 0; hash_num < _hash_func_vector.getHashNum(); ++hash_num) {
-        hash_set[hash_num][vertex_id] = minHash(_hash_func_vector[hash_num],
-                                                graph.incidentEdges(vertex_id));
-      }
-    }
+    parallel::parallelFor(begin, end, num_threads, [&](const size_t vertex_id) {
+        calculateHashes(graph, vertex_id, 0, hash_set);
+      });
   }
 
   void calculateLastHash(const Hypergraph& graph, const VertexSet& vertices,
                          MyHashSet& hash_set) const {
-    ALWAYS_ASSERT(getHashNum() > 0, "The number of hashes should be greater than zero");
-    for (const auto& vertex_id : vertices) {
-      const size_t last_hash = _hash_func_vector.getHashNum() - 1;
-      hash_set[last_hash][vertex_id] = minHash(_hash_func_vector[last_hash],
-                                               graph.incidentEdges(vertex_id));
-    }
+    calculateLastHashes(graph, vertices.cbegin(), vertices.cend(), 1, hash_set);
   }
 
   template <typename Iterator>
   void calculateLastHash(const Hypergraph& graph, const Iterator begin, const Iterator end,
                          MyHashSet& hash_set) const {
+    calculateLastHashes(graph, begin, end, 1, hash_set);
+  }
+
+  // calculates the minHashes of the last num_hashes hash functions for the vertices in
+  // [begin, end). The vertices are split into num_threads blocks of consecutive vertices.
+  template <typename Iterator>
+  void calculateLastHashes(const Hypergraph& graph, const Iterator begin, const Iterator end,
+                           const size_t num_hashes, MyHashSet& hash_set,
+                           const size_t num_threads = 1) const {
     ALWAYS_ASSERT(getHashNum() > 0, "The number of hashes should be greater than zero");
-    for (auto it = begin; it != end; ++it) {
-      const size_t last_hash = _hash_func_vector.getHashNum() - 1;
-      hash_set[last_hash][*it] = minHash(_hash_func_vector[last_hash], graph.incidentEdges(*it));
-    }
+    ASSERT(num_hashes <= getHashNum() && hash_set.getHashNum() == getHashNum());
+    const size_t first_hash = getHashNum() - num_hashes;
+    parallel::parallelFor(0, end - begin, num_threads, [&](const size_t i) {
+        calculateHashes(graph, *(begin + i), first_hash, hash_set);
+      });
   }
 
   HashValue combinedHash(const Hypergraph& graph, const VertexId vertex_id) const {
     ALWAYS_ASSERT(getHashNum() > 0, "The number of hashes should be greater than zero");
     HashValue val = 0;
-    for (uint32_t hash_num = 0; hash_num < _hash_func_vector.getHashNum(); ++hash_num) {
-      val ^= minHash(_hash_func_vector[hash_num], graph.incidentEdges(vertex_id));
+    HashValue min_hashes[kHashBlockSize];
+    for (size_t first_hash = 0; first_hash < getHashNum(); first_hash += kHashBlockSize) {
+      const size_t num_hashes = std::min(kHashBlockSize, getHashNum() - first_hash);
+      minHashBlock(graph, vertex_id, first_hash, num_hashes, min_hashes);
+      for (size_t i = 0; i < num_hashes; ++i) {
+        val ^= min_hashes[i];
+      }
     }
     return val;
   }
@@ -133,15 +145,41 @@ class MinHashPolicy {
 
   HashFuncVector<HashFunc> _hash_func_vector;
 
-  // calculates minHash from incident edges of a particular vertex
-  template <typename ValuesRange>
-  HashValue minHash(HashFunc hash, const ValuesRange& values_range) const {
-    HashValue res = std::numeric_limits<HashValue>::max();
+  // calculates the minHashes of the hash functions [first_hash, getHashNum()) for a vertex
+  void calculateHashes(const Hypergraph& graph, const VertexId vertex_id,
+                       const size_t first_hash, MyHashSet& hash_set) const {
+    HashValue min_hashes[kHashBlockSize];
+    for (size_t hash = first_hash; hash < getHashNum(); hash += kHashBlockSize) {
+      const size_t num_hashes = std::min(kHashBlockSize, getHashNum() - hash);
+      minHashBlock(graph, vertex_id, hash, num_hashes, min_hashes);
+      for (size_t i = 0; i < num_hashes; ++i) {
+        hash_set[hash + i][vertex_id] = min_hashes[i];
+      }
+    }
+  }
 
-    for (const auto& value : values_range) {
-      res = std::min(res, hash(value));
+  // calculates the minHashes of the hash functions [first_hash, first_hash + num_hashes)
+  // from the incident edges of a particular vertex in a single pass over the edges.
+  // Full blocks use a fixed trip count for the inner loop such that the compiler can
+  // vectorize the hash evaluation and the min reduction across the hash functions.
+  void minHashBlock(const Hypergraph& graph, const VertexId vertex_id, const size_t first_hash,
+                    const size_t num_hashes, HashValue* min_hashes) const {
+    ASSERT(num_hashes > 0 && num_hashes <= kHashBlockSize);
+    const HashFunc* hash_funcs = &_hash_func_vector[first_hash];
+    std::fill(min_hashes, min_hashes + num_hashes, std::numeric_limits<HashValue>::max());
+    if (num_hashes == kHashBlockSize) {
+      for (const HyperedgeID& he : graph.incidentEdges(vertex_id)) {
+        for (size_t i = 0; i < kHashBlockSize; ++i) {
+          min_hashes[i] = std::min(min_hashes[i], hash_funcs[i](he));
+        }
+      }
+    } else {
+      for (const HyperedgeID& he : graph.incidentEdges(vertex_id)) {
+        for (size_t i = 0; i < num_hashes; ++i) {
+          min_hashes[i] = std::min(min_hashes[i], hash_funcs[i](he));
+        }
+      }
     }
-    return res;
   }
 };
 
@@ -21,6 +21,13 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -32,6 +39,9 @@
 #include "kahypar/partition/multilevel.h"
 #include "kahypar/partition/preprocessing/louvain.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/timer.h"
 
 namespace kahypar {
 namespace recursive_bisection {
@@ -61,6 +71,28 @@ class RBState {
   const PartitionID upper_k;
 };
 
+// ! Sub-hypergraph of task-parallel recursive bisection that has to be
+// ! partitioned into blocks lower_k..upper_k.
+class RBTask {
+ public:
+  RBTask(HypergraphPtr h, std::vector<HypernodeID>&& original_hns, const PartitionID lk,
+         const PartitionID uk, const int task_id) :
+    hypergraph(std::move(h)),
+    original_hypernodes(std::move(original_hns)),
+    lower_k(lk),
+    upper_k(uk),
+    id(task_id) { }
+
+  HypergraphPtr hypergraph;
+  // Maps each hypernode of hypergraph to the corresponding hypernode of the
+  // hypergraph that is partitioned via recursive bisection.
+  std::vector<HypernodeID> original_hypernodes;
+  const PartitionID lower_k;
+  const PartitionID upper_k;
+  // Position in the recursion tree (root = 1, children of task i = 2i and 2i + 1)
+  const int id;
+};
+
 static inline HypernodeID originalHypernode(const HypernodeID hn,
                                             const MappingStack& mapping_stack) {
   HypernodeID node = hn;
@@ -146,6 +178,208 @@ static inline Context createCurrentBisectionContext(const Context& original_cont
   return current_context;
 }
 
+// ! Computes a bisection of current_hypergraph using the multilevel paradigm.
+static inline void bisect(Hypergraph& current_hypergraph, const Context& current_context,
+                          const int bisection_counter) {
+  const bool direct_kway_verbose =
+    current_context.type == ContextType::initial_partitioning &&
+    current_context.initial_partitioning.verbose_output;
+  const bool recursive_bisection_verbose =
+    current_context.type == ContextType::main &&
+    current_context.partition.verbose_output;
+  const bool verbose_output = direct_kway_verbose || recursive_bisection_verbose;
+
+  if (verbose_output) {
+    LOG << "Recursive Bisection No." << bisection_counter << ": Computing blocks ("
+        << current_context.partition.rb_lower_k << ".."
+        << current_context.partition.rb_upper_k << ")";
+    LOG << "L_max0:" << current_context.partition.max_part_weights[0];
+    LOG << "L_max1:" << current_context.partition.max_part_weights[1];
+    LOG << R"(========================================)"
+           R"(========================================)";
+  }
+
+  if (current_context.preprocessing.enable_community_detection) {
+    if (recursive_bisection_verbose) {
+      LOG << "******************************************"
+             "**************************************";
+      LOG << "*                               Preprocessing..."
+             "                               *";
+      LOG << "*********************************************"
+             "***********************************";
+    }
+
+    // For both recursive bisection and direct k-way partitioning mode, we allow to reuse
+    // community structure information. Direct k-way partitioning uses recursive bisection
+    // as initial partitioning mode. Using the reuse_communities flag, we can therefore
+    // decide whether or not the community structure found before the first bisection
+    // (which corresponds to the community structure of the input hypergraph for recursive
+    // bisection based partitioning and to the community structure of the coarse hypergraph
+    // for direct k-way partitioning) should be reused in subsequent bisections. Note that
+    // the community structure computed in the top level preprocessing phase of direct k-way
+    // partitioning is not used here, because we clear the communities vector before calling
+    // the initial partitioner (see initial_partition.h).
+    const bool detect_communities =
+      !current_context.preprocessing.community_detection.reuse_communities ||
+      bisection_counter == 1;
+    if (detect_communities && current_hypergraph.initialNumNodes() > 0) {
+      detectCommunities(current_hypergraph, current_context);
+    } else if (verbose_output) {
+      LOG << "Reusing community structure computed in first bisection";
+    }
+  }
+
+  std::unique_ptr<ICoarsener> coarsener(
+    CoarsenerFactory::getInstance().createObject(
+      current_context.coarsening.algorithm,
+      current_hypergraph, current_context,
+      current_hypergraph.weightOfHeaviestNode()));
+
+  std::unique_ptr<IRefiner> refiner(
+    RefinerFactory::getInstance().createObject(
+      current_context.local_search.algorithm,
+      current_hypergraph, current_context));
+
+  ASSERT(coarsener.get() != nullptr, "coarsener not found");
+  ASSERT(refiner.get() != nullptr, "refiner not found");
+
+  if (current_hypergraph.initialNumNodes() > 0) {
+    multilevel::partition(current_hypergraph, *coarsener, *refiner, current_context);
+  }
+
+  if (verbose_output) {
+    LOG << R"(========================================)"
+           R"(========================================)";
+  }
+}
+
+/*!
+ * Task-parallel recursive bisection.
+ *
+ * The two sub-hypergraphs extracted after each bisection are independent of
+ * each other and are therefore spawned as tasks on a work-stealing pool.
+ * Each task knows the original hypernodes of its sub-hypergraph, such that
+ * finished tasks can record the final blocks without synchronization. The
+ * blocks are applied to hypergraph after all tasks finished. Each bisection
+ * reseeds the random number generator of its thread based on its position
+ * in the recursion tree, so the result does not depend on the number of
+ * threads or on the order in which tasks are executed.
+ */
+static inline void partitionTaskParallel(Hypergraph& hypergraph,
+                                         const Context& original_context) {
+  using TaskPtr = std::shared_ptr<RBTask>;
+  auto no_delete = [](Hypergraph*) { };
+  auto delete_hypergraph = [](Hypergraph* h) {
+                             delete h;
+                           };
+
+  std::vector<PartitionID> final_parts(hypergraph.initialNumNodes(),
+                                       Hypergraph::kInvalidPartition);
+  std::atomic<int> bisection_counter(0);
+  const int seed = Randomize::instance().newRandomSeed();
+  const int continuation_seed = Randomize::instance().newRandomSeed();
+
+  // Timings of bisections executed on worker threads are merged into
+  // the timer of the calling thread after all tasks finished. The same
+  // holds for the stats of concurrent bisections, which are added to the
+  // stats of the original context in the order of their task ids.
+  std::vector<Timer> worker_timers;
+  std::map<int, std::string> bisection_stats;
+  std::mutex worker_results_mutex;
+
+  parallel::TaskPool pool(original_context.shared_memory.num_threads);
+  std::function<void(const TaskPtr&, const size_t)> process;
+  process = [&](const TaskPtr& task, const size_t thread_id) {
+              Hypergraph& current_hypergraph = *task->hypergraph;
+              const PartitionID k1 = task->lower_k;
+              const PartitionID k2 = task->upper_k;
+
+              if (k1 == k2) {
+                for (const HypernodeID& hn : current_hypergraph.nodes()) {
+                  final_parts[task->original_hypernodes[hn]] = k1;
+                }
+                return;
+              }
+
+              const PartitionID k = k2 - k1 + 1;
+              const PartitionID km = k / 2;
+
+              Randomize::instance().setSeed(seed + task->id);
+              Context current_context =
+                createCurrentBisectionContext(original_context, hypergraph,
+                                              current_hypergraph, k, km, k - km, k1);
+              current_context.partition.rb_lower_k = k1;
+              current_context.partition.rb_upper_k = k2;
+              if (task->id != 1) {
+                // Only the first bisection runs exclusively. All other bisections
+                // run concurrently and therefore use a single thread and do not
+                // report their stats to the shared parent context directly.
+                current_context.stats.detachFromParent();
+                current_context.shared_memory.num_threads = 1;
+              }
+
+              bisect(current_hypergraph, current_context, ++bisection_counter);
+
+              if (task->id != 1) {
+                std::string serialized_stats = current_context.stats.serialize().str();
+                std::lock_guard<std::mutex> lock(worker_results_mutex);
+                bisection_stats.emplace(task->id, std::move(serialized_stats));
+              }
+
+              for (const PartitionID part : { 1, 0 }) {
+                auto extracted_hypergraph =
+                  ds::extractPartAsUnpartitionedHypergraphForBisection(
+                    current_hypergraph, part, original_context.partition.objective);
+                std::vector<HypernodeID>& original_hypernodes = extracted_hypergraph.second;
+                for (HypernodeID& hn : original_hypernodes) {
+                  hn = task->original_hypernodes[hn];
+                }
+                const TaskPtr child = std::make_shared<RBTask>(
+                  HypergraphPtr(extracted_hypergraph.first.release(), delete_hypergraph),
+                  std::move(original_hypernodes),
+                  part == 0 ? k1 : k1 + km,
+                  part == 0 ? k1 + km - 1 : k2,
+                  2 * task->id + part);
+                pool.spawn(thread_id, [&process, child](const size_t tid) {
+                    process(child, tid);
+                  });
+              }
+
+              if (thread_id != 0) {
+                std::lock_guard<std::mutex> lock(worker_results_mutex);
+                worker_timers.push_back(Timer::instance());
+                Timer::instance().clear();
+              }
+            };
+
+  std::vector<HypernodeID> identity(hypergraph.initialNumNodes());
+  std::iota(identity.begin(), identity.end(), 0);
+  const TaskPtr root = std::make_shared<RBTask>(HypergraphPtr(&hypergraph, no_delete),
+                                                std::move(identity), 0,
+                                                original_context.partition.k - 1, 1);
+  pool.spawn(0, [&process, root](const size_t tid) {
+      process(root, tid);
+    });
+  pool.run();
+
+  for (const Timer& timer : worker_timers) {
+    Timer::instance().merge(timer);
+  }
+  for (const auto& stats : bisection_stats) {
+    original_context.stats.addSerialized(stats.second);
+  }
+  Randomize::instance().setSeed(continuation_seed);
+
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    const PartitionID current_part = hypergraph.partID(hn);
+    ASSERT(current_part != Hypergraph::kInvalidPartition, V(current_part));
+    ASSERT(final_parts[hn] != Hypergraph::kInvalidPartition, V(hn));
+    if (current_part != final_parts[hn]) {
+      hypergraph.changeNodePart(hn, current_part, final_parts[hn]);
+    }
+  }
+}
+
 static inline void partition(Hypergraph& input_hypergraph,
                              const Context& original_context) {
   // Custom deleters for Hypergraphs stored in hypergraph_stack. The top-level
@@ -178,10 +412,6 @@ static inline void partition(Hypergraph& input_hypergraph,
   std::vector<RBState> hypergraph_stack;
   MappingStack mapping_stack;
 
-  hypergraph_stack.emplace_back(HypergraphPtr(input_hypergraph_without_fixed_vertices.get(), no_delete),
-                                RBHypergraphState::unpartitioned, 0,
-                                (original_context.partition.k - 1));
-
   int bisection_counter = 0;
 
   if ((original_context.type == ContextType::main && original_context.partition.verbose_output) ||
@@ -190,6 +420,16 @@ static inline void partition(Hypergraph& input_hypergraph,
     LOG << "================================================================================";
   }
 
+  if (original_context.shared_memory.parallel_recursive_bisection) {
+    // The hypergraph stack remains empty, i.e., the sequential loop below is skipped.
+    partitionTaskParallel(*input_hypergraph_without_fixed_vertices, original_context);
+  } else {
+    hypergraph_stack.emplace_back(HypergraphPtr(input_hypergraph_without_fixed_vertices.get(),
+                                                no_delete),
+                                  RBHypergraphState::unpartitioned, 0,
+                                  (original_context.partition.k - 1));
+  }
+
   while (!hypergraph_stack.empty()) {
     Hypergraph& current_hypergraph = *hypergraph_stack.back().hypergraph;
 
@@ -230,72 +470,7 @@ static inline void partition(Hypergraph& input_hypergraph,
           current_context.partition.rb_upper_k = k2;
           ++bisection_counter;
 
-          const bool direct_kway_verbose =
-            current_context.type == ContextType::initial_partitioning &&
-            current_context.initial_partitioning.verbose_output;
-          const bool recursive_bisection_verbose =
-            current_context.type == ContextType::main &&
-            current_context.partition.verbose_output;
-          const bool verbose_output = direct_kway_verbose || recursive_bisection_verbose;
-
-          if (verbose_output) {
-            LOG << "Recursive Bisection No." << bisection_counter << ": Computing blocks ("
-                << current_context.partition.rb_lower_k << ".."
-                << current_context.partition.rb_upper_k << ")";
-            LOG << "L_max0:" << current_context.partition.max_part_weights[0];
-            LOG << "L_max1:" << current_context.partition.max_part_weights[1];
-            LOG << R"(========================================)"
-                   R"(========================================)";
-          }
-
-          if (current_context.preprocessing.enable_community_detection) {
-            if (recursive_bisection_verbose) {
-              LOG << "******************************************"
-                     "**************************************";
-              LOG << "*                               Preprocessing..."
-                     "                               *";
-              LOG << "*********************************************"
-                     "***********************************";
-            }
-
-            // For both recursive bisection and direct k-way partitioning mode, we allow to reuse
-            // community structure information. Direct k-way partitioning uses recursive bisection
-            // as initial partitioning mode. Using the reuse_communities flag, we can therefore
-            // decide whether or not the community structure found before the first bisection
-            // (which corresponds to the community structure of the input hypergraph for recursive
-            // bisection based partitioning and to the community structure of the coarse hypergraph
-            // for direct k-way partitioning) should be reused in subsequent bisections. Note that
-            // the community structure computed in the top level preprocessing phase of direct k-way
-            // partitioning is not used here, because we clear the communities vector before calling
-            // the initial partitioner (see initial_partition.h).
-            const bool detect_communities =
-              !current_context.preprocessing.community_detection.reuse_communities ||
-              bisection_counter == 1;
-            if (detect_communities && current_hypergraph.initialNumNodes() > 0) {
-              detectCommunities(current_hypergraph, current_context);
-            } else if (verbose_output) {
-              LOG << "Reusing community structure computed in first bisection";
-            }
-          }
-
-
-          std::unique_ptr<ICoarsener> coarsener(
-            CoarsenerFactory::getInstance().createObject(
-              current_context.coarsening.algorithm,
-              current_hypergraph, current_context,
-              current_hypergraph.weightOfHeaviestNode()));
-
-          std::unique_ptr<IRefiner> refiner(
-            RefinerFactory::getInstance().createObject(
-              current_context.local_search.algorithm,
-              current_hypergraph, current_context));
-
-          ASSERT(coarsener.get() != nullptr, "coarsener not found");
-          ASSERT(refiner.get() != nullptr, "refiner not found");
-
-          if (current_hypergraph.initialNumNodes() > 0) {
-            multilevel::partition(current_hypergraph, *coarsener, *refiner, current_context);
-          }
+          bisect(current_hypergraph, current_context, bisection_counter);
 
           auto extractedHypergraph_1 = ds::extractPartAsUnpartitionedHypergraphForBisection(
             current_hypergraph, 1, current_context.partition.objective);
@@ -306,11 +481,6 @@ static inline void partition(Hypergraph& input_hypergraph,
           hypergraph_stack.emplace_back(HypergraphPtr(extractedHypergraph_1.first.release(),
                                                       delete_hypergraph),
                                         RBHypergraphState::unpartitioned, k1 + km, k2);
-
-          if (verbose_output) {
-            LOG << R"(========================================)"
-                   R"(========================================)";
-          }
           break;
         }
       case RBHypergraphState::partitionedAndPart1Extracted: {
@@ -48,21 +48,28 @@
 
 namespace kahypar {
 template <class StoppingPolicy = Mandatory,
+          class PriorityQueuePolicy = BinaryHeapPriorityQueue,
           class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
 class TwoWayFMRefiner final : public IRefiner,
                               private FMRefinerBase<HypernodeID,
                                                     TwoWayFMRefiner<StoppingPolicy,
-                                                                    FMImprovementPolicy> >{
+                                                                    PriorityQueuePolicy,
+                                                                    FMImprovementPolicy>,
+                                                    PriorityQueuePolicy>{
  private:
   static constexpr bool enable_heavy_assert = false;
   static constexpr bool debug = false;
 
   using HypernodeWeightArray = std::array<HypernodeWeight, 2>;
   using Base = FMRefinerBase<HypernodeID, TwoWayFMRefiner<StoppingPolicy,
-                                                          FMImprovementPolicy> >;
+                                                          PriorityQueuePolicy,
+                                                          FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   friend class FMRefinerBase<HypernodeID, TwoWayFMRefiner<StoppingPolicy,
-                                                          FMImprovementPolicy> >;
+                                                          PriorityQueuePolicy,
+                                                          FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   using HEState = typename Base::HEState;
   using Base::kInvalidGain;
@@ -139,15 +146,8 @@ class TwoWayFMRefiner final : public IRefiner,
   FRIEND_TEST(ATwoWayFMRefiner, KnowsIfAHyperedgeIsFullyActive);
 
   void initializeImpl(const HyperedgeWeight max_gain) override final {
-    if (!_is_initialized) {
-#ifdef USE_BUCKET_QUEUE
-      _pq.initialize(_hg.initialNumNodes(), max_gain);
-#else
-      unused(max_gain);
-      _pq.initialize(_hg.initialNumNodes());
-#endif
-      _is_initialized = true;
-    }
+    Base::initializePQ(max_gain);
+    _is_initialized = true;
     _gain_cache.clear();
     for (const HypernodeID& hn : _hg.nodes()) {
       _gain_cache.setValue(hn, computeGain(hn));
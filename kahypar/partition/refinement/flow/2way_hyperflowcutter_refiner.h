@@ -22,6 +22,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,7 @@
 #include "kahypar/partition/refinement/flow/flow_refiner_base.h"
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/move.h"
+#include "kahypar/utils/randomize.h"
 #include "kahypar/utils/time_limit.h"
 #include <kahypar/partition/refinement/i_refiner.h>
 #include <kahypar/utils/timer.h>
@@ -66,7 +68,10 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
     _quotient_graph(nullptr),
     _ignore_flow_execution_policy(false),
     b0(0),
-    b1(1) {
+    b1(1),
+    _flow_problem(),
+    _new_cut(0),
+    _should_continue(false) {
     hfc.find_most_balanced = context.local_search.hyperflowcutter.most_balanced_cut;
     hfc.timer.active = false;
     should_write_snapshot = context.local_search.hyperflowcutter.snapshot_path != "None";
@@ -86,6 +91,92 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
 
   RefinementResult refinement_result = RefinementResult::NoImprovement;
 
+  // ! Heuristic: Flows are not computed on block pairs with a small cut,
+  // ! except on the finest level.
+  bool isCutWorthRefining(const std::vector<HyperedgeID>& cut_hes) const {
+    HyperedgeWeight cut_weight = 0;
+    for (HyperedgeID e : cut_hes) {
+      cut_weight += _hg.edgeWeight(e);
+      if (cut_weight > 10)
+        break;
+    }
+    return cut_weight > 10 || isRefinementOnLastLevel();
+  }
+
+  // ! Extracts the flow problem around the given cut hyperedges of the configured
+  // ! block pair and runs HyperFlowCutter on it. Returns whether the resulting
+  // ! bipartition should be applied via applyImprovement(). Only reads the
+  // ! hypergraph, i.e., it can be called concurrently on refiners configured with
+  // ! disjoint block pairs.
+  bool computeImprovement(const std::vector<HyperedgeID>& cut_hes) {
+    hfc.cs.setMaxBlockWeight(0, _context.partition.max_part_weights[b0]);
+    hfc.cs.setMaxBlockWeight(1, _context.partition.max_part_weights[b1]);
+    _should_continue = false;
+
+    hfc.timer.start("Extract Flow Snapshot");
+    _flow_problem = extractor.run(_hg, _context, cut_hes, b0, b1, hfc.cs.borderNodes.distance);
+    hfc.timer.stop("Extract Flow Snapshot");
+    const auto& STF = _flow_problem;
+
+    if (STF.cutAtStake - STF.baseCut <= 0) {
+      return false;
+    }
+
+    if (should_write_snapshot) {
+      writeSnapshot(STF);
+    }
+
+    hfc.reset();
+    hfc.upperFlowBound = STF.cutAtStake - STF.baseCut;
+    bool flowcutter_succeeded = hfc.runUntilBalancedOrFlowBoundExceeded(STF.source, STF.target);
+    _new_cut = STF.baseCut + hfc.cs.flowValue;
+
+    bool should_update = false;
+    if (flowcutter_succeeded) {
+      should_update = determineRefinementResult(_new_cut, STF.cutAtStake) !=
+                      RefinementResult::NoImprovement;
+      ASSERT(should_update || _new_cut > STF.cutAtStake,
+             "HFC succeeded but it improved neither metric nor local balance.");
+    }
+
+    // Heuristic (gottesbueren): if only balance was improved we don't continue
+    _should_continue = should_update && _new_cut < STF.cutAtStake;
+    return should_update;
+  }
+
+  // ! Assigns the new partition IDs computed by the last call of computeImprovement().
+  // ! Concurrently refined block pairs may have changed the weights of the other
+  // ! blocks in the meantime. Thus, the improvement is classified against the
+  // ! current part weights here.
+  void applyImprovement() {
+    refinement_result = std::max(refinement_result,
+                                 determineRefinementResult(_new_cut, _flow_problem.cutAtStake));
+    for (const whfc::Node uLocal : extractor.localNodeIDs()) {
+      if (uLocal == _flow_problem.source || uLocal == _flow_problem.target)
+        continue;
+      const HypernodeID uGlobal = extractor.local2global(uLocal);
+      PartitionID from = _hg.partID(uGlobal);
+      ASSERT(from == b0 || from == b1);
+      PartitionID to = hfc.cs.n.isSource(uLocal) ? b0 : b1;
+      if (from != to)
+        _quotient_graph->changeNodePart(uGlobal, from, to);
+    }
+
+    DBG << "Update partition" << V(metrics::imbalance(_hg, _context)) << V(b0) << V(b1) << V(_hg.currentNumNodes());
+    if (_hg.partWeight(b0) > _context.partition.max_part_weights[b0] || _hg.partWeight(b1) > _context.partition.max_part_weights[b1]) {
+      LOG << "HFC refinement violated imbalance" << std::fixed << std::setprecision(12) << V(_context.partition.epsilon) << V(metrics::imbalance(_hg, _context));
+      LOG << V(_hg.partWeight(b0)) << V(_context.partition.max_part_weights[b0]) << V(_hg.partWeight(b1)) << V(_context.partition.max_part_weights[b1]);
+      LOG << "This is a bug. Please send us an email.";
+      throw std::runtime_error("imbalance violated");
+    }
+  }
+
+  // ! Whether the flow computation should be repeated on the configured block pair
+  // ! after the improvement of the last call of computeImprovement() was applied.
+  bool shouldContinue() const {
+    return _should_continue;
+  }
+
   void reportRunningTime() {
     hfc.timer.report(std::cout);
   }
@@ -114,9 +205,6 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
       _quotient_graph->buildQuotientGraph();
     }
 
-    hfc.cs.setMaxBlockWeight(0, _context.partition.max_part_weights[b0]);
-    hfc.cs.setMaxBlockWeight(1, _context.partition.max_part_weights[b1]);
-
     DBG << "2way HFC. Refine " << V(b0) << "and" << V(b1);
 
     bool improved = false;
@@ -125,65 +213,17 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
 
     while (should_continue) {
       std::vector<HyperedgeID>& cut_hes = _quotient_graph->exposeBlockPairCutHyperedges(b0, b1);
-
-      HyperedgeWeight cut_weight = 0;
-      for (HyperedgeID e : cut_hes) {
-        cut_weight += _hg.edgeWeight(e);
-        if (cut_weight > 10)
-          break;
-      }
-
-      if (cut_weight <= 10 && !isRefinementOnLastLevel()) {
-        break;
-      }
-
-      hfc.timer.start("Extract Flow Snapshot");
-      auto STF = extractor.run(_hg, _context, cut_hes, b0, b1, hfc.cs.borderNodes.distance);
-      hfc.timer.stop("Extract Flow Snapshot");
-
-      if (STF.cutAtStake - STF.baseCut <= 0) {
+      if (!isCutWorthRefining(cut_hes)) {
         break;
       }
-  
-      if (should_write_snapshot) {
-        writeSnapshot(STF);
-      }
-      
-      hfc.reset();
-      hfc.upperFlowBound = STF.cutAtStake - STF.baseCut;
-      bool flowcutter_succeeded = hfc.runUntilBalancedOrFlowBoundExceeded(STF.source, STF.target);
-      HyperedgeWeight newCut = STF.baseCut + hfc.cs.flowValue;
-
-      bool should_update = false;
-      if (flowcutter_succeeded) {
-        should_update = determineRefinementResult(newCut, STF.cutAtStake);
-      }
+      std::shuffle(cut_hes.begin(), cut_hes.end(), Randomize::instance().getGenerator());
 
-      // assign new partition IDs
+      const bool should_update = computeImprovement(cut_hes);
       if (should_update) {
         improved = true;
-        for (const whfc::Node uLocal : extractor.localNodeIDs()) {
-          if (uLocal == STF.source || uLocal == STF.target)
-            continue;
-          const HypernodeID uGlobal = extractor.local2global(uLocal);
-          PartitionID from = _hg.partID(uGlobal);
-          ASSERT(from == b0 || from == b1);
-          PartitionID to = hfc.cs.n.isSource(uLocal) ? b0 : b1;
-          if (from != to)
-            _quotient_graph->changeNodePart(uGlobal, from, to);
-        }
-
-        DBG << "Update partition" << V(metrics::imbalance(_hg, _context)) << V(b0) << V(b1) << V(_hg.currentNumNodes());
-        if (_hg.partWeight(b0) > _context.partition.max_part_weights[b0] || _hg.partWeight(b1) > _context.partition.max_part_weights[b1]) {
-          LOG << "HFC refinement violated imbalance" << std::fixed << std::setprecision(12) << V(_context.partition.epsilon) << V(metrics::imbalance(_hg, _context));
-          LOG << V(_hg.partWeight(b0)) << V(_context.partition.max_part_weights[b0]) << V(_hg.partWeight(b1)) << V(_context.partition.max_part_weights[b1]);
-          LOG << "This is a bug. Please send us an email.";
-          throw std::runtime_error("imbalance violated");
-        }
+        applyImprovement();
       }
-
-      // Heuristic (gottesbueren): if only balance was improved we don't continue
-      should_continue = should_update && newCut < STF.cutAtStake;
+      should_continue = shouldContinue();
     }
 
     DBG << "HFC refinement done";
@@ -209,7 +249,7 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
     _flow_execution_policy.initialize(_hg, _context);
   }
 
-  bool isRefinementOnLastLevel() {
+  bool isRefinementOnLastLevel() const {
     return _hg.currentNumNodes() == _hg.initialNumNodes();
   }
 
@@ -227,24 +267,27 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
   }
 
 
-  void writeSnapshot(whfcInterface::FlowHypergraphExtractor::AdditionalData& STF) {
+  void writeSnapshot(const whfcInterface::FlowHypergraphExtractor::AdditionalData& STF) {
     whfc::WHFC_IO::WHFCInformation i = {
       { whfc::NodeWeight(_context.partition.max_part_weights[b0]), whfc::NodeWeight(_context.partition.max_part_weights[b1]) },
       STF.cutAtStake - STF.baseCut, STF.source, STF.target
     };
+    // Refiners of different block pairs can write snapshots concurrently. Thus,
+    // all refiners share one counter such that each snapshot gets its own file.
+    static std::atomic<size_t> snapshot_counter(0);
     std::string hg_filename = _context.local_search.hyperflowcutter.snapshot_path
                               + _context.partition.graph_filename.substr(_context.partition.graph_filename.find_last_of('/') + 1)
-                              + ".snapshot" + std::to_string(instance_counter);
-    instance_counter++;
+                              + ".snapshot" + std::to_string(snapshot_counter++);
     LOG << "Wrote snapshot: " << hg_filename;
     whfc::HMetisIO::writeFlowHypergraph(extractor.flow_hg_builder, hg_filename);
     whfc::WHFC_IO::writeAdditionalInformation(hg_filename, i, hfc.cs.rng);
   }
 
-  bool determineRefinementResult(HyperedgeWeight newCut, HyperedgeWeight cutAtStake) {
+  // ! Classifies the bipartition computed by HyperFlowCutter against the current
+  // ! part weights. Must be called before the bipartition is applied.
+  RefinementResult determineRefinementResult(HyperedgeWeight newCut, HyperedgeWeight cutAtStake) const {
     if (newCut < cutAtStake) {
-      refinement_result = std::max(refinement_result, RefinementResult::MetricImproved);
-      return true;
+      return RefinementResult::MetricImproved;
     } else if (newCut == cutAtStake) {
       double prevLocalImbalance = -2.0, prevGlobalImbalance = -2.0, newLocalImbalance = -2.0, newGlobalImbalance = -2.0;
 
@@ -263,18 +306,13 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
       }
 
       if (newGlobalImbalance < prevGlobalImbalance) {
-        refinement_result = std::max(refinement_result, RefinementResult::GlobalBalanceImproved);
+        return RefinementResult::GlobalBalanceImproved;
       } else if (newLocalImbalance < prevLocalImbalance) {
-        refinement_result = std::max(refinement_result, RefinementResult::LocalBalanceImproved);
-      } else {
-        ASSERT(false, "HFC succeeded but it improved neither metric nor local balance.");
-        return false;
+        return RefinementResult::LocalBalanceImproved;
       }
-
-      return true;
     }
 
-    return false;
+    return RefinementResult::NoImprovement;
   }
 
   double imbalance(const HypernodeWeight blockWeight, const HypernodeWeight maxBlockWeight) const {
@@ -289,12 +327,14 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
   using Base::_flow_execution_policy;
 
   bool should_write_snapshot = false;
-  size_t instance_counter = 0;
   whfcInterface::FlowHypergraphExtractor extractor;
   whfc::HyperFlowCutter<whfc::Dinic> hfc;
   QuotientGraphBlockScheduler* _quotient_graph;
   bool _ignore_flow_execution_policy;
   PartitionID b0;
   PartitionID b1;
+  whfcInterface::FlowHypergraphExtractor::AdditionalData _flow_problem;
+  HyperedgeWeight _new_cut;
+  bool _should_continue;
 };
 }  // namespace kahypar
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <memory>
 #include <queue>
 #include <string>
 #include <utility>
@@ -39,7 +40,10 @@
 #include "kahypar/partition/refinement/flow/flow_refiner_base.h"
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
 #include "kahypar/utils/time_limit.h"
+#include "kahypar/utils/timer.h"
 
 namespace kahypar {
 using ds::SparseSet;
@@ -51,13 +55,28 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
                                          private FlowRefinerBase<FlowExecutionPolicy>{
  private:
   using Base = FlowRefinerBase<FlowExecutionPolicy>;
+  using TwoWayRefiner = TwoWayHyperFlowCutterRefiner<FlowExecutionPolicy>;
+  using BlockPair = std::pair<PartitionID, PartitionID>;
   static constexpr bool debug = false;
 
+  // State of a block pair during the parallel refinement of a matching
+  struct BlockPairRefinement {
+    BlockPair blocks;
+    bool improved;
+    RefinementResult result;
+  };
+
  public:
   KWayHyperFlowCutterRefiner(Hypergraph& hypergraph, const Context& context) :
     Base(hypergraph, context),
     _twoway_flow_refiner(_hg, _context),
-    _num_improvements(context.partition.k, std::vector<size_t>(context.partition.k, 0)) { }
+    _parallel_flow_refiners(),
+    _num_improvements(context.partition.k, std::vector<size_t>(context.partition.k, 0)) {
+    // _twoway_flow_refiner is used by the first thread
+    for (size_t i = 1; i < numThreads(); ++i) {
+      _parallel_flow_refiners.emplace_back(std::make_unique<TwoWayRefiner>(_hg, _context));
+    }
+  }
 
   KWayHyperFlowCutterRefiner(const KWayHyperFlowCutterRefiner&) = delete;
   KWayHyperFlowCutterRefiner(KWayHyperFlowCutterRefiner&&) = delete;
@@ -100,6 +119,7 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
       scheduler.randomShuffleQuotientEdges();
       std::vector<bool> tmp_active_blocks(_context.partition.k, false);
       active_block_exist = false;
+      std::vector<BlockPair> block_pairs;
       for (const auto& e : scheduler.quotientGraphEdges()) {
         const PartitionID block_0 = e.first;
         const PartitionID block_1 = e.second;
@@ -111,6 +131,33 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
           continue;
 
         if (active_blocks[block_0] || active_blocks[block_1]) {
+          block_pairs.push_back(e);
+        }
+      }
+
+      if (numThreads() > 1) {
+        // Block pairs of a matching share no block and are refined concurrently
+        for (const std::vector<BlockPair>& matching : scheduler.computeMatchings(block_pairs)) {
+          for (const BlockPairRefinement& pair : refineMatching(matching, scheduler)) {
+            if (pair.improved) {
+              improvement = true;
+              if (pair.result >= RefinementResult::GlobalBalanceImproved) {
+                active_block_exist = true;
+                tmp_active_blocks[pair.blocks.first] = true;
+                tmp_active_blocks[pair.blocks.second] = true;
+                _num_improvements[pair.blocks.first][pair.blocks.second]++;
+              }
+            }
+          }
+
+          if (_context.partition.time_limit_triggered) {
+            break;
+          }
+        }
+      } else {
+        for (const BlockPair& e : block_pairs) {
+          const PartitionID block_0 = e.first;
+          const PartitionID block_1 = e.second;
           _twoway_flow_refiner.updateConfiguration(block_0, block_1, &scheduler, true);
           const bool improved = _twoway_flow_refiner.refine(refinement_nodes, max_allowed_part_weights, changes, best_metrics);
           if (improved) {
@@ -127,10 +174,10 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
               _num_improvements[block_0][block_1]++;
             }
           }
-        }
 
-        if (_context.partition.time_limit_triggered) {
-          break;
+          if (_context.partition.time_limit_triggered) {
+            break;
+          }
         }
       }
       current_round++;
@@ -144,6 +191,87 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
     return improvement;
   }
 
+  size_t numThreads() const {
+    return _context.shared_memory.parallel_flow_refinement ?
+           std::max(std::min(_context.shared_memory.num_threads,
+                             static_cast<size_t>(_context.partition.k / 2)),
+                    static_cast<size_t>(1)) : 1;
+  }
+
+  TwoWayRefiner& flowRefiner(const size_t thread_id) {
+    return thread_id == 0 ? _twoway_flow_refiner : *_parallel_flow_refiners[thread_id - 1];
+  }
+
+  // Refines all block pairs of a matching of the quotient graph. Each step
+  // extracts and solves the flow problems of (up to numThreads()) block pairs
+  // concurrently, since this only reads the hypergraph, and applies the
+  // improvements sequentially afterwards. Since the block pairs are disjoint,
+  // the improvements do not interfere: the change of the cut/km1 metric of a
+  // hyperedge is the sum of the changes in its pin counts of the two block
+  // pairs. As in the sequential mode, a block pair is refined repeatedly until
+  // its cut does not improve anymore.
+  std::vector<BlockPairRefinement> refineMatching(const std::vector<BlockPair>& matching,
+                                                  QuotientGraphBlockScheduler& scheduler) {
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+
+    std::vector<BlockPairRefinement> pairs;
+    std::vector<size_t> active_pairs;
+    for (const BlockPair& blocks : matching) {
+      active_pairs.push_back(pairs.size());
+      pairs.push_back({ blocks, false, RefinementResult::NoImprovement });
+    }
+
+    std::vector<size_t> next_active_pairs;
+    std::vector<const std::vector<HyperedgeID>*> cut_hes(numThreads(), nullptr);
+    std::vector<uint8_t> should_update(numThreads(), false);
+    while (!active_pairs.empty()) {
+      next_active_pairs.clear();
+      for (size_t step_begin = 0; step_begin < active_pairs.size(); step_begin += numThreads()) {
+        const size_t step_size = std::min(numThreads(), active_pairs.size() - step_begin);
+
+        // The cut hyperedges are updated and shuffled sequentially
+        for (size_t i = 0; i < step_size; ++i) {
+          const BlockPair& blocks = pairs[active_pairs[step_begin + i]].blocks;
+          TwoWayRefiner& refiner = flowRefiner(i);
+          refiner.updateConfiguration(blocks.first, blocks.second, &scheduler, true);
+          refiner.refinement_result = RefinementResult::NoImprovement;
+          std::vector<HyperedgeID>& block_pair_cut_hes =
+            scheduler.exposeBlockPairCutHyperedges(blocks.first, blocks.second);
+          cut_hes[i] = nullptr;
+          if (refiner.isCutWorthRefining(block_pair_cut_hes)) {
+            std::shuffle(block_pair_cut_hes.begin(), block_pair_cut_hes.end(),
+                         Randomize::instance().getGenerator());
+            cut_hes[i] = &block_pair_cut_hes;
+          }
+        }
+
+        parallel::executeConcurrent(step_size, [&](const size_t thread_id) {
+            should_update[thread_id] = cut_hes[thread_id] != nullptr &&
+                                       flowRefiner(thread_id).computeImprovement(*cut_hes[thread_id]);
+          });
+
+        for (size_t i = 0; i < step_size; ++i) {
+          if (should_update[i]) {
+            BlockPairRefinement& pair = pairs[active_pairs[step_begin + i]];
+            TwoWayRefiner& refiner = flowRefiner(i);
+            refiner.applyImprovement();
+            pair.improved = true;
+            pair.result = std::max(pair.result, refiner.refinement_result);
+            if (refiner.shouldContinue()) {
+              next_active_pairs.push_back(active_pairs[step_begin + i]);
+            }
+          }
+        }
+      }
+      std::swap(active_pairs, next_active_pairs);
+    }
+
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    Timer::instance().add(_context, Timepoint::flow_refinement, std::chrono::duration<double>(end - start).count());
+    time_limit::isSoftTimeLimitExceeded(_context);
+    return pairs;
+  }
+
   void printMetric(bool newline = false, bool endline = false) {
     if (newline) {
       DBG << "";
@@ -160,6 +288,9 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
     _is_initialized = true;
     _flow_execution_policy.initialize(_hg, _context);
     _twoway_flow_refiner.initialize(max_gain);
+    for (std::unique_ptr<TwoWayRefiner>& refiner : _parallel_flow_refiners) {
+      refiner->initialize(max_gain);
+    }
   }
 
   using IRefiner::_is_initialized;
@@ -169,7 +300,9 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
   using Base::_original_part_id;
   using Base::_flow_execution_policy;
 
-  TwoWayHyperFlowCutterRefiner<FlowExecutionPolicy> _twoway_flow_refiner;
+  TwoWayRefiner _twoway_flow_refiner;
+  // Additional two-way refiners used by the threads of the parallel mode
+  std::vector<std::unique_ptr<TwoWayRefiner> > _parallel_flow_refiners;
   std::vector<std::vector<size_t> > _num_improvements;
 };
 }  // namespace kahypar
@@ -83,6 +83,33 @@ class QuotientGraphBlockScheduler {
     return std::make_pair(_quotient_graph.cbegin(), _quotient_graph.cend());
   }
 
+  // ! Splits the given quotient graph edges into matchings, i.e., sets of block
+  // ! pairs that share no block. The edges are assigned greedily in the given
+  // ! order to the first matching in which both blocks are still unmatched, such
+  // ! that each matching is maximal w.r.t. the edges of all later matchings.
+  std::vector<std::vector<edge> > computeMatchings(const std::vector<edge>& edges) const {
+    std::vector<std::vector<edge> > matchings;
+    std::vector<edge> remaining_edges = edges;
+    std::vector<edge> unmatched_edges;
+    std::vector<bool> is_matched(_context.partition.k, false);
+    while (!remaining_edges.empty()) {
+      matchings.emplace_back();
+      std::fill(is_matched.begin(), is_matched.end(), false);
+      unmatched_edges.clear();
+      for (const edge& e : remaining_edges) {
+        if (!is_matched[e.first] && !is_matched[e.second]) {
+          is_matched[e.first] = true;
+          is_matched[e.second] = true;
+          matchings.back().push_back(e);
+        } else {
+          unmatched_edges.push_back(e);
+        }
+      }
+      std::swap(remaining_edges, unmatched_edges);
+    }
+    return matchings;
+  }
+
   void assignBlockPairCutHyperedges(PartitionID block0, PartitionID block1, std::vector<HyperedgeID>&& cut_hes) {
     if (block1 < block0)
       std::swap(block0, block1);
@@ -58,7 +58,9 @@ class FlowHypergraphExtractor {
     whfc::Flow cutAtStake;                      // Compare this to the flow value, to determine whether an improvement was found
   };
 
-  AdditionalData run(const Hypergraph& hg, const Context& context, std::vector<HyperedgeID>& cut_hes,
+  // The order of cut_hes determines the BFS order. The caller is responsible for shuffling,
+  // such that the extraction only reads the hypergraph and can run concurrently.
+  AdditionalData run(const Hypergraph& hg, const Context& context, const std::vector<HyperedgeID>& cut_hes,
                      const PartitionID _b0, const PartitionID _b1, whfc::DistanceFromCut& distanceFromCut) {
     whfc::HopDistance hop_distance_delta = context.local_search.hyperflowcutter.use_distances_from_cut ? 1 : 0;
 
@@ -67,7 +69,6 @@ class FlowHypergraphExtractor {
 
     auto[maxW0, maxW1] = flowHyperGraphPartSizes(context, hg);
     HypernodeWeight w0 = 0, w1 = 0;
-    std::shuffle(cut_hes.begin(), cut_hes.end(), Randomize::instance().getGenerator());
 
     // collect b0
     result.source = whfc::Node::fromOtherValueType(queue.queueEnd());
@@ -23,11 +23,11 @@
 #include <limits>
 #include <vector>
 
-#include "kahypar/datastructure/bucket_queue.h"
-#include "kahypar/datastructure/kway_priority_queue.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/move.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/uncontraction_gain_changes.h"
 
 namespace kahypar {
@@ -38,7 +38,8 @@ struct RollbackInfo {
 };
 
 template <typename RollbackElement = Mandatory,
-          typename Derived = Mandatory>
+          typename Derived = Mandatory,
+          typename PriorityQueuePolicy = BinaryHeapPriorityQueue>
 class FMRefinerBase {
  private:
   static constexpr bool debug = false;
@@ -62,30 +63,33 @@ class FMRefinerBase {
     locked = std::numeric_limits<PartitionID>::max(),
   };
 
-#ifdef USE_BUCKET_QUEUE
-  using KWayRefinementPQ = ds::KWayPriorityQueue<HypernodeID, Gain,
-                                                 std::numeric_limits<Gain>,
-                                                 false,
-                                                 ds::EnhancedBucketQueue<HypernodeID,
-                                                                         Gain,
-                                                                         std::numeric_limits<Gain>
-                                                                         > >;
-#else
-  using KWayRefinementPQ = ds::KWayPriorityQueue<HypernodeID, Gain,
-                                                 std::numeric_limits<Gain> >;
-#endif
-
+  using KWayRefinementPQ = typename PriorityQueuePolicy::KWayPQ;
 
   FMRefinerBase(Hypergraph& hypergraph, const Context& context) :
     _hg(hypergraph),
     _context(context),
     _pq(context.partition.k),
+    _pq_is_initialized(false),
+    _pq_max_gain(0),
     _performed_moves(),
-    _hns_to_activate() {
+    _hns_to_activate(),
+    _imbalance(hypergraph, context) {
     _performed_moves.reserve(_hg.initialNumNodes());
     _hns_to_activate.reserve(_hg.initialNumNodes());
   }
 
+  // ! max_gain is an upper bound on the absolute gain of all moves (only used by bucket queues).
+  // ! Since it differs between the coarsest levels of different V-cycles, queues that depend
+  // ! on it are rebuilt whenever it changes.
+  void initializePQ(const HyperedgeWeight max_gain) {
+    if (!_pq_is_initialized ||
+        (PriorityQueuePolicy::kDependsOnMaxGain && max_gain != _pq_max_gain)) {
+      PriorityQueuePolicy::initialize(_pq, _hg.initialNumNodes(), max_gain, _context);
+      _pq_is_initialized = true;
+      _pq_max_gain = max_gain;
+    }
+  }
+
   bool hypernodeIsConnectedToPart(const HypernodeID pin, const PartitionID part) const {
     for (const HyperedgeID& he : _hg.incidentEdges(pin)) {
       if (_hg.pinCountInPart(he, part) > 0) {
@@ -156,6 +160,7 @@ class FMRefinerBase {
                                   std::vector<HypernodeID>& refinement_nodes,
                                   const UncontractionGainChanges&) {
     reset();
+    _imbalance.initialize();
     Derived* derived = static_cast<Derived*>(this);
     for (const HypernodeID& hn : refinement_nodes) {
       derived->_gain_cache.clear(hn);
@@ -170,6 +175,7 @@ class FMRefinerBase {
                                                                               move.to));
       }
       _hg.changeNodePart(move.hn, move.from, move.to);
+      _imbalance.update(move.from, move.to);
       _hg.activate(move.hn);
       _hg.mark(move.hn);
       derived->updateNeighboursGainCacheOnly(move.hn, move.from, move.to);
@@ -212,6 +218,7 @@ class FMRefinerBase {
       const PartitionID from_part = _performed_moves[last_index].to_part;
       const PartitionID to_part = _performed_moves[last_index].from_part;
       _hg.changeNodePart(hn, from_part, to_part);
+      _imbalance.update(from_part, to_part);
       --last_index;
     }
   }
@@ -219,7 +226,13 @@ class FMRefinerBase {
   Hypergraph& _hg;
   const Context& _context;
   KWayRefinementPQ _pq;
+  bool _pq_is_initialized;
+  // ! max_gain the queues were last built for
+  HyperedgeWeight _pq_max_gain;
   std::vector<RollbackElement> _performed_moves;
   std::vector<HypernodeID> _hns_to_activate;
+  // Imbalance after all moves performed via rollback. Refiners using it have to
+  // update it after moveHypernode and initialize it at the beginning of each pass.
+  metrics::ImbalanceTracker _imbalance;
 };
 }  // namespace kahypar
@@ -46,21 +46,28 @@
 
 namespace kahypar {
 template <class StoppingPolicy = Mandatory,
+          class PriorityQueuePolicy = BinaryHeapPriorityQueue,
           class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
 class KWayFMRefiner final : public IRefiner,
                             private FMRefinerBase<RollbackInfo, KWayFMRefiner<StoppingPolicy,
-                                                                              FMImprovementPolicy> >{
+                                                                              PriorityQueuePolicy,
+                                                                              FMImprovementPolicy>,
+                                                  PriorityQueuePolicy>{
  private:
   static constexpr bool enable_heavy_assert = false;
   static constexpr bool debug = false;
   static constexpr HypernodeID hn_to_debug = 4242;
 
-  using GainCache = KwayGainCache<Gain>;
+  using GainCache = KwayFMGainCache<Gain>;
   using Base = FMRefinerBase<RollbackInfo, KWayFMRefiner<StoppingPolicy,
-                                                         FMImprovementPolicy> >;
+                                                         PriorityQueuePolicy,
+                                                         FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   friend class FMRefinerBase<RollbackInfo, KWayFMRefiner<StoppingPolicy,
-                                                         FMImprovementPolicy> >;
+                                                         PriorityQueuePolicy,
+                                                         FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   using HEState = typename Base::HEState;
   using Base::kInvalidGain;
@@ -73,7 +80,8 @@ class KWayFMRefiner final : public IRefiner,
     _tmp_gains(_context.partition.k, 0),
     _already_processed_part(_hg.initialNumNodes(), Hypergraph::kInvalidPartition),
     _locked_hes(_hg.initialNumEdges(), HEState::free),
-    _gain_cache(_hg.initialNumNodes(), _context.partition.k),
+    _gain_cache(_hg.initialNumNodes(), _context.partition.k,
+                _context.local_search.fm.max_gain_cache_arena_size),
     _stopping_policy() { }
 
   ~KWayFMRefiner() override = default;
@@ -90,16 +98,9 @@ class KWayFMRefiner final : public IRefiner,
   FRIEND_TEST(AKwayFMRefiner, KnowsIfAHyperedgeIsFullyActive);
 
   void initializeImpl(const HyperedgeWeight max_gain) override final {
-    if (!_is_initialized) {
-#ifdef USE_BUCKET_QUEUE
-      _pq.initialize(_hg.initialNumNodes(), max_gain);
-#else
-      unused(max_gain);
-      _pq.initialize(_hg.initialNumNodes());
-#endif
-      _is_initialized = true;
-    }
-    _gain_cache.clear();
+    Base::initializePQ(max_gain);
+    _is_initialized = true;
+    _gain_cache.initialize();
     initializeGainCache();
   }
 
@@ -124,7 +125,7 @@ class KWayFMRefiner final : public IRefiner,
     Base::reset();
     _he_fully_active.reset();
     _locked_hes.resetUsedEntries();
-
+    _imbalance.initialize();
 
     Randomize::instance().shuffleVector(refinement_nodes, refinement_nodes.size());
     for (const HypernodeID& hn : refinement_nodes) {
@@ -193,13 +194,14 @@ class KWayFMRefiner final : public IRefiner,
 
       if (Base::moveIsFeasible(max_gain_node, from_part, to_part)) {
         Base::moveHypernode(max_gain_node, from_part, to_part);
+        _imbalance.update(from_part, to_part);
 
         Base::updatePQpartState(from_part,
                                 to_part,
                                 _context.partition.max_part_weights[from_part],
                                 _context.partition.max_part_weights[to_part]);
 
-        current_imbalance = metrics::imbalance(_hg, _context);
+        current_imbalance = _imbalance.imbalance();
 
         current_cut -= max_gain;
         _stopping_policy.updateStatistics(max_gain);
@@ -1099,6 +1101,7 @@ class KWayFMRefiner final : public IRefiner,
   using Base::_pq;
   using Base::_performed_moves;
   using Base::_hns_to_activate;
+  using Base::_imbalance;
 
   ds::FastResetFlagArray<> _he_fully_active;
   ds::SparseMap<PartitionID, Gain> _tmp_gains;
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -29,32 +30,215 @@
 #include "kahypar/partition/refinement/gain_cache_element.h"
 
 namespace kahypar {
-template <typename Gain = Mandatory>
+// Stores the cache element of each hypernode in a separate allocation. Cache elements
+// are only allocated for hypernodes that actually have a cache entry.
+template <typename KFMCacheElement>
+class SeparateCacheElementStorage {
+ private:
+  using Byte = char;
+
+ public:
+  // The arena size limit only applies to ArenaCacheElementStorage.
+  SeparateCacheElementStorage(const HypernodeID num_hns, const PartitionID k,
+                              const size_t = std::numeric_limits<size_t>::max()) :
+    _k(k),
+    _num_hns(num_hns),
+    _cache_element_size(static_cast<size_t>(sizeof(KFMCacheElement)) +
+                        _k * sizeof(typename KFMCacheElement::Element) +
+                        _k * sizeof(PartitionID)),
+    _cache(std::make_unique<KFMCacheElement*[]>(num_hns)) { }
+
+  ~SeparateCacheElementStorage() {
+    if (_cache != nullptr) {
+      for (size_t i = 0; i < _num_hns; ++i) {
+        delete[] (reinterpret_cast<Byte*>(_cache[i]));
+      }
+    }
+  }
+
+  SeparateCacheElementStorage(const SeparateCacheElementStorage&) = delete;
+  SeparateCacheElementStorage& operator= (const SeparateCacheElementStorage&) = delete;
+
+  SeparateCacheElementStorage(SeparateCacheElementStorage&&) = default;
+  SeparateCacheElementStorage& operator= (SeparateCacheElementStorage&&) = default;
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool contains(const HypernodeID hn) const {
+    return _cache[hn] != nullptr;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE const KFMCacheElement* get(const HypernodeID hn) const {
+    return _cache[hn];
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE KFMCacheElement* get(const HypernodeID hn) {
+    return _cache[hn];
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE KFMCacheElement* getOrCreate(const HypernodeID hn) {
+    if (unlikely(_cache[hn] == nullptr)) {
+      _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
+    }
+    return _cache[hn];
+  }
+
+  // Cache elements are allocated on demand, so there is nothing to allocate up front.
+  void initialize() {
+    clear();
+  }
+
+  void clear() {
+    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
+      if (_cache[hn] != nullptr) {  /// workaround
+        delete[] (reinterpret_cast<Byte*>(_cache[hn]));
+        _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
+      }
+    }
+  }
+
+ private:
+  PartitionID _k;
+  HypernodeID _num_hns;
+  size_t _cache_element_size;
+  std::unique_ptr<KFMCacheElement*[]> _cache;
+};
+
+// Stores the cache elements of all hypernodes consecutively in one memory arena
+// that is allocated once. Since all cache elements have the same size, the
+// element of a hypernode is located via its ID and no indirection is needed.
+// The arena holds an element for each of the n hypernodes, i.e., it requires
+// n * k * (sizeof(Element) + sizeof(PartitionID)) bytes. If this exceeds
+// max_arena_size, the elements are allocated separately instead.
+template <typename KFMCacheElement>
+class ArenaCacheElementStorage {
+ private:
+  using Byte = char;
+  using Element = typename KFMCacheElement::Element;
+
+ public:
+  ArenaCacheElementStorage(const HypernodeID num_hns, const PartitionID k,
+                           const size_t max_arena_size = std::numeric_limits<size_t>::max()) :
+    _k(k),
+    _num_hns(num_hns),
+    _cache_element_size(alignedSize(static_cast<size_t>(sizeof(KFMCacheElement)) +
+                                    _k * sizeof(Element) + _k * sizeof(PartitionID))),
+    _max_arena_size(max_arena_size),
+    _initialized(false),
+    _arena(),
+    _contained(),
+    _separate_storage(0, k) { }
+
+  ~ArenaCacheElementStorage() = default;
+
+  ArenaCacheElementStorage(const ArenaCacheElementStorage&) = delete;
+  ArenaCacheElementStorage& operator= (const ArenaCacheElementStorage&) = delete;
+
+  ArenaCacheElementStorage(ArenaCacheElementStorage&&) = default;
+  ArenaCacheElementStorage& operator= (ArenaCacheElementStorage&&) = default;
+
+  // Allocates the storage on the first call. Refiners are constructed before it is
+  // known whether they are used at all, so allocating in the constructor would
+  // reserve n * k entries for refiners that never refine.
+  void initialize() {
+    if (_initialized) {
+      clear();
+    } else if (arenaSize() <= _max_arena_size) {
+      _arena = std::make_unique<Byte[]>(arenaSize());
+      _contained.assign(_num_hns, false);
+      _initialized = true;
+    } else {
+      _separate_storage = SeparateCacheElementStorage<KFMCacheElement>(_num_hns, _k);
+      _initialized = true;
+    }
+  }
+
+  bool usesArena() const {
+    return _arena != nullptr;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool contains(const HypernodeID hn) const {
+    ASSERT(_initialized, "Gain cache is not initialized");
+    return usesArena() ? _contained[hn] : _separate_storage.contains(hn);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE const KFMCacheElement* get(const HypernodeID hn) const {
+    return usesArena() ? reinterpret_cast<const KFMCacheElement*>(element(hn)) :
+           _separate_storage.get(hn);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE KFMCacheElement* get(const HypernodeID hn) {
+    return usesArena() ? reinterpret_cast<KFMCacheElement*>(element(hn)) :
+           _separate_storage.get(hn);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE KFMCacheElement* getOrCreate(const HypernodeID hn) {
+    if (!usesArena()) {
+      return _separate_storage.getOrCreate(hn);
+    }
+    if (unlikely(!_contained[hn])) {
+      new(element(hn))KFMCacheElement(_k);
+      _contained[hn] = true;
+    }
+    return get(hn);
+  }
+
+  void clear() {
+    if (!usesArena()) {
+      _separate_storage.clear();
+      return;
+    }
+    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
+      if (_contained[hn]) {
+        get(hn)->clear();
+      }
+    }
+  }
+
+ private:
+  // Pads the cache elements such that the entries of consecutive elements are aligned.
+  static size_t alignedSize(const size_t size) {
+    constexpr size_t alignment = std::max(alignof(KFMCacheElement), alignof(Element));
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  size_t arenaSize() const {
+    return static_cast<size_t>(_num_hns) * _cache_element_size;
+  }
+
+  Byte* element(const HypernodeID hn) const {
+    return _arena.get() + static_cast<size_t>(hn) * _cache_element_size;
+  }
+
+  PartitionID _k;
+  HypernodeID _num_hns;
+  size_t _cache_element_size;
+  size_t _max_arena_size;
+  bool _initialized;
+  std::unique_ptr<Byte[]> _arena;
+  // ! Marks the hypernodes whose cache element was created in the arena
+  std::vector<bool> _contained;
+  // ! Used instead of the arena if it would exceed max_arena_size
+  SeparateCacheElementStorage<KFMCacheElement> _separate_storage;
+};
+
+template <typename Gain = Mandatory,
+          template <typename> class CacheElementStorage = SeparateCacheElementStorage>
 class KwayGainCache {
  private:
   static const bool debug = false;
   static const HypernodeID hn_to_debug = 2;
 
-  using Byte = char;
   using KFMCacheElement = CacheElement<Gain>;
 
  public:
   static constexpr HyperedgeWeight kNotCached = KFMCacheElement::kNotCached;
 
-  KwayGainCache(const HypernodeID num_hns, const PartitionID k) :
+  KwayGainCache(const HypernodeID num_hns, const PartitionID k,
+                const size_t max_arena_size = std::numeric_limits<size_t>::max()) :
     _k(k),
-    _num_hns(num_hns),
-    _cache_element_size(static_cast<size_t>(sizeof(KFMCacheElement)) +
-                        _k * sizeof(typename KFMCacheElement::Element) +
-                        _k * sizeof(PartitionID)),
-    _cache(std::make_unique<KFMCacheElement*[]>(num_hns)),
+    _cache(num_hns, k, max_arena_size),
     _deltas() { }
 
-  ~KwayGainCache() {
-    for (size_t i = 0; i < _num_hns; ++i) {
-      delete[] (reinterpret_cast<Byte*>(_cache[i]));
-    }
-  }
+  ~KwayGainCache() = default;
 
   KwayGainCache(const KwayGainCache&) = delete;
   KwayGainCache& operator= (const KwayGainCache&) = delete;
@@ -64,7 +248,7 @@ class KwayGainCache {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE Gain entry(const HypernodeID hn, const PartitionID part) const {
     DBGC(hn == hn_to_debug) << "entry access for HN" << hn << "and part" << part;
-    ASSERT(_cache[hn] != nullptr);
+    ASSERT(_cache.contains(hn));
     ASSERT(part < _k, V(part));
     return cacheElement(hn)->gain(part);
   }
@@ -74,19 +258,19 @@ class KwayGainCache {
     ASSERT(part < _k, V(part));
     DBGC(hn == hn_to_debug) << "existence check for HN" << hn << "and part" << part
                             << "=" << cacheElement(hn)->contains(part);
-    return _cache[hn] != nullptr && cacheElement(hn)->contains(part);
+    return _cache.contains(hn) && cacheElement(hn)->contains(part);
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool entryExists(const HypernodeID hn) const {
     DBGC(hn == hn_to_debug) << "existence check for HN" << hn;
-    return _cache[hn] != nullptr;
+    return _cache.contains(hn);
   }
 
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void removeEntryDueToConnectivityDecrease(const HypernodeID hn,
                                                                             const PartitionID part) {
     ASSERT(part < _k, V(part));
-    ASSERT(_cache[hn] != nullptr);
+    ASSERT(_cache.contains(hn));
     _deltas.emplace_back(hn, part, cacheElement(hn)->gain(part), RollbackAction::do_add);
     DBGC(hn == hn_to_debug) << "removeEntryDueToConnectivityDecrease for" << hn
                             << "and part" << part << "previous cache entry ="
@@ -99,11 +283,8 @@ class KwayGainCache {
                                                                          const PartitionID part,
                                                                          const Gain gain) {
     ASSERT(part < _k, V(part));
-    if (unlikely(_cache[hn] == nullptr)) {
-      _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
-    }
     ASSERT(!entryExists(hn, part), V(hn) << V(part));
-    cacheElement(hn)->add(part, gain);
+    _cache.getOrCreate(hn)->add(part, gain);
     DBGC(hn == hn_to_debug) << "addEntryDueToConnectivityIncrease for" << hn
                             << "and part" << part << "new cache entry ="
                             << cacheElement(hn)->gain(part);
@@ -115,7 +296,7 @@ class KwayGainCache {
                                                                     const PartitionID from_part,
                                                                     const PartitionID to_part,
                                                                     const bool remains_connected_to_from_part) {
-    ASSERT(_cache[moved_hn] != nullptr);
+    ASSERT(_cache.contains(moved_hn));
     if (remains_connected_to_from_part) {
       DBGC(moved_hn == hn_to_debug) << "updateFromAndToPartOfMovedHN(" << moved_hn
                                     << "," << from_part << "," << to_part << ")";
@@ -137,7 +318,7 @@ class KwayGainCache {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void clear(const HypernodeID hn) {
     DBGC(hn == hn_to_debug) << "clear(" << hn << ")";
-    if (_cache[hn] != nullptr) {
+    if (_cache.contains(hn)) {
       cacheElement(hn)->clear();
     }
   }
@@ -145,10 +326,7 @@ class KwayGainCache {
   void initializeEntry(const HypernodeID hn, const PartitionID part, const Gain value) {
     ASSERT(part < _k, V(part));
     DBGC(hn == hn_to_debug) << "initializeEntry(" << hn << "," << part << "," << value << ")";
-    if (unlikely(_cache[hn] == nullptr)) {
-      _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
-    }
-    cacheElement(hn)->add(part, value);
+    _cache.getOrCreate(hn)->add(part, value);
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateEntryIfItExists(const HypernodeID hn,
@@ -163,7 +341,7 @@ class KwayGainCache {
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateExistingEntry(const HypernodeID hn,
                                                            const PartitionID part,
                                                            const Gain delta) {
-    ASSERT(_cache[hn] != nullptr);
+    ASSERT(_cache.contains(hn));
     ASSERT(part < _k, V(part));
     ASSERT(entryExists(hn, part), V(hn) << V(part));
     ASSERT(cacheElement(hn)->gain(part) != kNotCached, V(hn) << V(part));
@@ -206,32 +384,34 @@ class KwayGainCache {
     return *cacheElement(hn);
   }
 
+  // ! Has to be called before the cache is used. Removes all entries.
+  void initialize() {
+    _cache.initialize();
+  }
+
   void clear() {
-    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
-      if (_cache[hn] != nullptr) {  /// workaround
-        delete[] (reinterpret_cast<Byte*>(_cache[hn]));
-        _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
-      }
-    }
+    _cache.clear();
   }
 
  private:
   const KFMCacheElement* cacheElement(const HypernodeID hn) const {
-    return _cache[hn];
+    return _cache.get(hn);
   }
 
-  // To avoid code duplication we implement non-const version in terms of const version
   KFMCacheElement* cacheElement(const HypernodeID hn) {
-    return _cache[hn];
+    return _cache.get(hn);
   }
 
   PartitionID _k;
-  HypernodeID _num_hns;
-  const size_t _cache_element_size;
-  std::unique_ptr<KFMCacheElement*[]> _cache;
+  CacheElementStorage<KFMCacheElement> _cache;
   std::vector<RollbackElement> _deltas;
 };
 
+template <typename Gain, template <typename> class CacheElementStorage>
+constexpr HyperedgeWeight KwayGainCache<Gain, CacheElementStorage>::kNotCached;
+
+// The k-way FM refiners use the arena unless it exceeds
+// context.local_search.fm.max_gain_cache_arena_size.
 template <typename Gain>
-constexpr HyperedgeWeight KwayGainCache<Gain>::kNotCached;
+using KwayFMGainCache = KwayGainCache<Gain, ArenaCacheElementStorage>;
 }  // namespace kahypar
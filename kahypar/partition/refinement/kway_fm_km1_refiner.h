@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <stack>
 #include <string>
@@ -43,24 +44,33 @@
 #include "kahypar/partition/refinement/kway_fm_gain_cache.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/utils/float_compare.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
 template <class StoppingPolicy = Mandatory,
+          class PriorityQueuePolicy = BinaryHeapPriorityQueue,
           class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
 class KWayKMinusOneRefiner final : public IRefiner,
-                                   private FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy, FMImprovementPolicy> >{
+                                   private FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy, PriorityQueuePolicy, FMImprovementPolicy>,
+                                                         PriorityQueuePolicy>{
  private:
   static constexpr bool enable_heavy_assert = false;
   static constexpr bool debug = false;
   static constexpr HypernodeID hn_to_debug = 5589;
+  // Minimum number of hypernodes per thread for parallel gain cache initialization.
+  static constexpr HypernodeID kMinNodesPerThread = 1000;
 
-  using GainCache = KwayGainCache<Gain>;
+  using GainCache = KwayFMGainCache<Gain>;
   using Base = FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy,
-                                                                FMImprovementPolicy> >;
+                                                                PriorityQueuePolicy,
+                                                                FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   friend class FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy,
-                                                                FMImprovementPolicy> >;
+                                                                PriorityQueuePolicy,
+                                                                FMImprovementPolicy>,
+                             PriorityQueuePolicy>;
 
   using HEState = typename Base::HEState;
   using Base::kInvalidGain;
@@ -84,9 +94,11 @@ class KWayKMinusOneRefiner final : public IRefiner,
   KWayKMinusOneRefiner(Hypergraph& hypergraph, const Context& context) :
     Base(hypergraph, context),
     _tmp_gains(_context.partition.k, 0),
+    _thread_tmp_gains(),
     _new_adjacent_part(_hg.initialNumNodes(), Hypergraph::kInvalidPartition),
     _unremovable_he_parts(static_cast<size_t>(_hg.initialNumEdges()) * context.partition.k),
-    _gain_cache(_hg.initialNumNodes(), _context.partition.k),
+    _gain_cache(_hg.initialNumNodes(), _context.partition.k,
+                _context.local_search.fm.max_gain_cache_arena_size),
     _stopping_policy() { }
 
   ~KWayKMinusOneRefiner() override = default;
@@ -98,17 +110,12 @@ class KWayKMinusOneRefiner final : public IRefiner,
   KWayKMinusOneRefiner& operator= (KWayKMinusOneRefiner&&) = delete;
 
  private:
+  FRIEND_TEST(AKWayKMinusOneRefiner, InitializesTheSameGainCacheInParallel);
+
   void initializeImpl(const HyperedgeWeight max_gain) override final {
-    if (!_is_initialized) {
-#ifdef USE_BUCKET_QUEUE
-      _pq.initialize(_hg.initialNumNodes(), max_gain);
-#else
-      unused(max_gain);
-      _pq.initialize(_hg.initialNumNodes());
-#endif
-      _is_initialized = true;
-    }
-    _gain_cache.clear();
+    Base::initializePQ(max_gain);
+    _is_initialized = true;
+    _gain_cache.initialize();
     initializeGainCache();
   }
 
@@ -132,6 +139,7 @@ class KWayKMinusOneRefiner final : public IRefiner,
 
     Base::reset();
     _unremovable_he_parts.reset();
+    _imbalance.initialize();
 
     Randomize::instance().shuffleVector(refinement_nodes, refinement_nodes.size());
     for (const HypernodeID& hn : refinement_nodes) {
@@ -195,13 +203,14 @@ class KWayKMinusOneRefiner final : public IRefiner,
 
       if (Base::moveIsFeasible(max_gain_node, from_part, to_part)) {
         Base::moveHypernode(max_gain_node, from_part, to_part);
+        _imbalance.update(from_part, to_part);
 
         Base::updatePQpartState(from_part,
                                 to_part,
                                 _context.partition.max_part_weights[from_part],
                                 _context.partition.max_part_weights[to_part]);
 
-        current_imbalance = metrics::imbalance(_hg, _context);
+        current_imbalance = _imbalance.imbalance();
 
         current_km1 -= max_gain;
         _stopping_policy.updateStatistics(max_gain);
@@ -855,26 +864,65 @@ class KWayKMinusOneRefiner final : public IRefiner,
     return gain;
   }
 
+  // Initializes the gain cache of all hypernodes. Since the cache entries of
+  // each hypernode are computed independently and only touch the cache element
+  // of that hypernode, the hypernodes are split into contiguous ranges that are
+  // processed concurrently, each thread using its own temporary gain map.
   void initializeGainCache() {
-    for (const HypernodeID& hn : _hg.nodes()) {
-      initializeGainCacheFor(hn);
+    const size_t num_threads = std::max(std::min(_context.shared_memory.num_threads,
+                                                 static_cast<size_t>(_hg.initialNumNodes()) /
+                                                 kMinNodesPerThread),
+                                        static_cast<size_t>(1));
+    if (num_threads == 1) {
+      for (const HypernodeID& hn : _hg.nodes()) {
+        initializeGainCacheFor(hn);
+      }
+      return;
+    }
+
+    while (_thread_tmp_gains.size() < num_threads - 1) {
+      _thread_tmp_gains.emplace_back(_context.partition.k, 0);
     }
+    const HypernodeID num_nodes = _hg.initialNumNodes();
+    const HypernodeID block_size = (num_nodes + num_threads - 1) / num_threads;
+    parallel::executeConcurrent(num_threads, [&](const size_t thread_id) {
+        ds::SparseMap<PartitionID, Gain>& tmp_gains =
+          thread_id == 0 ? _tmp_gains : _thread_tmp_gains[thread_id - 1];
+        const HypernodeID begin = std::min(static_cast<HypernodeID>(thread_id * block_size),
+                                           num_nodes);
+        const HypernodeID end = std::min(begin + block_size, num_nodes);
+        for (HypernodeID hn = begin; hn < end; ++hn) {
+          if (_hg.nodeIsEnabled(hn)) {
+            initializeGainCacheFor(hn, tmp_gains);
+          }
+        }
+      });
   }
 
   void initializeGainCacheFor(const HypernodeID hn) {
-    _tmp_gains.clear();
+    initializeGainCacheFor(hn, _tmp_gains);
+  }
+
+  void initializeGainCacheFor(const HypernodeID hn, ds::SparseMap<PartitionID, Gain>& tmp_gains) {
+    tmp_gains.clear();
     const PartitionID source_part = _hg.partID(hn);
     HyperedgeWeight internal = 0;
     for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
       const HyperedgeWeight he_weight = _hg.edgeWeight(he);
+      if (_hg.connectivity(he) == 1 && _hg.edgeSize(he) > 1) {
+        // Internal hyperedges only contribute to the gain of the source part,
+        // which is never cached. Single-pin hyperedges are never internal.
+        internal += he_weight;
+        continue;
+      }
       internal += _hg.pinCountInPart(he, source_part) != 1 ? he_weight : 0;
       for (const PartitionID& part : _hg.connectivitySet(he)) {
         ASSERT(part < _context.partition.k, V(part));
-        _tmp_gains[part] += he_weight;
+        tmp_gains[part] += he_weight;
       }
     }
 
-    for (const auto& target_part : _tmp_gains) {
+    for (const auto& target_part : tmp_gains) {
       if (target_part.key == source_part) {
         ASSERT(!_gain_cache.entryExists(hn, source_part), V(hn) << V(source_part));
         continue;
@@ -953,8 +1001,11 @@ class KWayKMinusOneRefiner final : public IRefiner,
   using Base::_pq;
   using Base::_performed_moves;
   using Base::_hns_to_activate;
+  using Base::_imbalance;
 
   ds::SparseMap<PartitionID, Gain> _tmp_gains;
+  // Temporary gain maps of the additional threads used to initialize the gain cache.
+  std::vector<ds::SparseMap<PartitionID, Gain> > _thread_tmp_gains;
 
   // After a move, we have to update the gains for all adjacent HNs.
   // For all moves of a HN that were already present in the PQ before the
@@ -0,0 +1,536 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest_prod.h"
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/definitions.h"
+#include "kahypar/meta/mandatory.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/fm_refiner_base.h"
+#include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
+
+namespace kahypar {
+/*!
+ * Parallel k-way FM refinement for the connectivity (km1) metric.
+ *
+ * A refinement round consists of two phases:
+ * 1.) Localized searches: Each of the num_threads threads repeatedly takes a
+ *     seed node from refinement_nodes and performs a small FM search that only
+ *     grows around the seed. The searches do not modify the hypergraph. Instead,
+ *     each search maintains the pin counts, part weights and block IDs that
+ *     changed due to its own moves as thread-local deltas on top of the
+ *     (read-only) hypergraph. A node can be moved by at most one search per
+ *     round, which is ensured by claiming it with an atomic round stamp.
+ *     Each search keeps the prefix of its moves with the best gain.
+ * 2.) Global move sequence: The kept moves of all searches are applied to the
+ *     hypergraph in the order in which the searches finished. Since the searches
+ *     did not see the moves of each other, the gain of each move is recalculated
+ *     when it is applied. Afterwards, the sequence is rolled back to its best
+ *     prefix using the same acceptance criteria as the sequential k-way FM.
+ *
+ * With more than one thread, the result depends on the scheduling of the
+ * searches and is therefore not deterministic.
+ */
+template <class StoppingPolicy = Mandatory,
+          class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
+class ParallelKWayKMinusOneRefiner final : public IRefiner {
+ private:
+  static constexpr bool debug = false;
+  static constexpr bool enable_heavy_assert = false;
+
+  // Only use additional threads if each of them gets at least this many seeds.
+  static constexpr size_t kMinSeedsPerThread = 8;
+
+  struct SearchMove {
+    HypernodeID hn;
+    PartitionID from_part;
+    PartitionID to_part;
+  };
+
+  class LocalizedSearch {
+ public:
+    LocalizedSearch(const Hypergraph& hypergraph, const Context& context) :
+      _hg(hypergraph),
+      _context(context),
+      _pq(hypergraph.initialNumNodes()),
+      _updated_neighbours(hypergraph.initialNumNodes()),
+      _part(hypergraph.initialNumNodes()),
+      _pin_count_delta_offset(hypergraph.initialNumEdges()),
+      _pin_count_delta(),
+      _part_weight_delta(context.partition.k, 0),
+      _part_size_delta(context.partition.k, 0),
+      _connected_weight(context.partition.k, 0),
+      _adjacent_parts(),
+      _local_to_parts(),
+      _touched_parts(),
+      _moves(),
+      _stopping_policy() { }
+
+    LocalizedSearch(const LocalizedSearch&) = delete;
+    LocalizedSearch& operator= (const LocalizedSearch&) = delete;
+
+    LocalizedSearch(LocalizedSearch&&) = delete;
+    LocalizedSearch& operator= (LocalizedSearch&&) = delete;
+
+    ~LocalizedSearch() = default;
+
+    // ! Performs a localized FM search starting at seed and returns the
+    // ! moves of the best prefix of the search.
+    const std::vector<SearchMove>& search(const HypernodeID seed,
+                                          ParallelKWayKMinusOneRefiner& refiner) {
+      reset();
+
+      Gain gain = 0;
+      PartitionID to_part = Hypergraph::kInvalidPartition;
+      if (!computeBestMove(seed, gain, to_part)) {
+        return _moves;
+      }
+      _pq.push(seed, gain);
+
+      const double beta = log(_hg.currentNumNodes());
+      Gain current_gain = 0;
+      Gain best_gain = 0;
+      size_t best_prefix = 0;
+      int touched_hns_since_last_improvement = 0;
+      while (!_pq.empty() &&
+             !_stopping_policy.searchShouldStop(touched_hns_since_last_improvement, _context,
+                                                beta, -best_gain, -current_gain)) {
+        const HypernodeID hn = _pq.top();
+        const Gain expected_gain = _pq.topKey();
+        _pq.pop();
+
+        // Moves of the current search might have changed the gain since hn was
+        // inserted. If the recalculated gain is worse than the next candidate,
+        // hn is reinserted with its actual gain.
+        if (!computeBestMove(hn, gain, to_part)) {
+          continue;
+        }
+        if (gain < expected_gain && !_pq.empty() && gain < _pq.topKey()) {
+          _pq.push(hn, gain);
+          continue;
+        }
+        // A node that would empty its block is skipped before it is claimed,
+        // such that other searches of this round can still move it.
+        const PartitionID from_part = partID(hn);
+        if (partSize(from_part) - 1 == 0 || !refiner.claim(hn)) {
+          continue;
+        }
+        moveHypernode(hn, from_part, to_part);
+        _moves.push_back(SearchMove { hn, from_part, to_part });
+        current_gain += gain;
+        _stopping_policy.updateStatistics(gain);
+        ++touched_hns_since_last_improvement;
+
+        if (current_gain > best_gain) {
+          best_gain = current_gain;
+          best_prefix = _moves.size();
+          touched_hns_since_last_improvement = 0;
+          _stopping_policy.resetStatistics();
+        }
+
+        updateNeighbours(hn, from_part, to_part, refiner);
+      }
+      DBG << "Localized search from" << seed << "performed" << _moves.size()
+          << "moves, best prefix:" << best_prefix << V(best_gain);
+
+      _moves.resize(best_prefix);
+      return _moves;
+    }
+
+ private:
+    FRIEND_TEST(AParallelKWayKMinusOneRefiner, ResetsAllPartDeltasOfRolledBackSearches);
+
+    void reset() {
+      _pq.clear();
+      _part.clear();
+      _pin_count_delta_offset.clear();
+      _pin_count_delta.clear();
+      // _moves only contains the best prefix of the last search, so the
+      // deltas are reset based on all blocks touched by any move.
+      for (const PartitionID& part : _touched_parts) {
+        _part_weight_delta[part] = 0;
+        _part_size_delta[part] = 0;
+      }
+      _local_to_parts.clear();
+      _touched_parts.clear();
+      _moves.clear();
+      _stopping_policy.resetStatistics();
+    }
+
+    PartitionID partID(const HypernodeID hn) const {
+      return _part.contains(hn) ? _part.get(hn) : _hg.partID(hn);
+    }
+
+    HypernodeID pinCountInPart(const HyperedgeID he, const PartitionID part) const {
+      HypernodeID pin_count = _hg.pinCountInPart(he, part);
+      if (_pin_count_delta_offset.contains(he)) {
+        pin_count += _pin_count_delta[_pin_count_delta_offset.get(he) + part];
+      }
+      return pin_count;
+    }
+
+    HypernodeWeight partWeight(const PartitionID part) const {
+      return _hg.partWeight(part) + _part_weight_delta[part];
+    }
+
+    HypernodeID partSize(const PartitionID part) const {
+      return _hg.partSize(part) + _part_size_delta[part];
+    }
+
+    void moveHypernode(const HypernodeID hn, const PartitionID from_part,
+                       const PartitionID to_part) {
+      _part[hn] = to_part;
+      _part_weight_delta[from_part] -= _hg.nodeWeight(hn);
+      _part_weight_delta[to_part] += _hg.nodeWeight(hn);
+      --_part_size_delta[from_part];
+      ++_part_size_delta[to_part];
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        if (!_pin_count_delta_offset.contains(he)) {
+          _pin_count_delta_offset.add(he, _pin_count_delta.size());
+          _pin_count_delta.resize(_pin_count_delta.size() + _context.partition.k, 0);
+        }
+        const size_t offset = _pin_count_delta_offset.get(he);
+        --_pin_count_delta[offset + from_part];
+        ++_pin_count_delta[offset + to_part];
+      }
+      if (std::find(_local_to_parts.begin(), _local_to_parts.end(), to_part) ==
+          _local_to_parts.end()) {
+        _local_to_parts.push_back(to_part);
+      }
+      touchPart(from_part);
+      touchPart(to_part);
+    }
+
+    void touchPart(const PartitionID part) {
+      if (std::find(_touched_parts.begin(), _touched_parts.end(), part) ==
+          _touched_parts.end()) {
+        _touched_parts.push_back(part);
+      }
+    }
+
+    // ! Inserts all unclaimed neighbors of hn into the PQ. The gains of neighbors
+    // ! that are already contained in the PQ are only recalculated if the move of hn
+    // ! from from_part to to_part changed the gain contribution of a shared hyperedge.
+    void updateNeighbours(const HypernodeID hn, const PartitionID from_part,
+                          const PartitionID to_part,
+                          const ParallelKWayKMinusOneRefiner& refiner) {
+      _updated_neighbours.reset();
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        if (_hg.edgeSize(he) > _context.partition.hyperedge_size_threshold) {
+          continue;
+        }
+        // The km1 gains of the pins of he only change if the pin count in
+        // from_part dropped to 1 or 0 or the pin count in to_part rose to 1 or 2.
+        const bool gains_changed = pinCountInPart(he, from_part) <= 1 ||
+                                   pinCountInPart(he, to_part) <= 2;
+        for (const HypernodeID& pin : _hg.pins(he)) {
+          if (_updated_neighbours[pin] || _hg.isFixedVertex(pin) || refiner.isClaimed(pin) ||
+              (!gains_changed && _pq.contains(pin))) {
+            continue;
+          }
+          _updated_neighbours.set(pin, true);
+          Gain gain = 0;
+          PartitionID to_part = Hypergraph::kInvalidPartition;
+          if (computeBestMove(pin, gain, to_part)) {
+            if (_pq.contains(pin)) {
+              _pq.updateKey(pin, gain);
+            } else {
+              _pq.push(pin, gain);
+            }
+          } else if (_pq.contains(pin)) {
+            _pq.remove(pin);
+          }
+        }
+      }
+    }
+
+    // ! Computes the best feasible move of hn to an adjacent block w.r.t. the
+    // ! local view of the partition. Returns false if no such move exists.
+    bool computeBestMove(const HypernodeID hn, Gain& best_gain, PartitionID& best_part) {
+      const PartitionID from_part = partID(hn);
+      HyperedgeWeight benefit = 0;
+      HyperedgeWeight incident_weight = 0;
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        const HyperedgeWeight he_weight = _hg.edgeWeight(he);
+        incident_weight += he_weight;
+        if (pinCountInPart(he, from_part) == 1) {
+          benefit += he_weight;
+        }
+        for (const PartitionID& part : _hg.connectivitySet(he)) {
+          if (part != from_part && pinCountInPart(he, part) > 0) {
+            addConnectedWeight(part, he_weight);
+          }
+        }
+        // Blocks that only became adjacent due to moves of this search
+        for (const PartitionID& part : _local_to_parts) {
+          if (part != from_part && _hg.pinCountInPart(he, part) == 0 &&
+              pinCountInPart(he, part) > 0) {
+            addConnectedWeight(part, he_weight);
+          }
+        }
+      }
+
+      best_gain = std::numeric_limits<Gain>::min();
+      best_part = Hypergraph::kInvalidPartition;
+      for (const PartitionID& part : _adjacent_parts) {
+        const Gain gain = benefit - (incident_weight - _connected_weight[part]);
+        if (gain > best_gain &&
+            partWeight(part) + _hg.nodeWeight(hn) <= _context.partition.max_part_weights[part]) {
+          best_gain = gain;
+          best_part = part;
+        }
+        _connected_weight[part] = 0;
+      }
+      _adjacent_parts.clear();
+      return best_part != Hypergraph::kInvalidPartition;
+    }
+
+    void addConnectedWeight(const PartitionID part, const HyperedgeWeight he_weight) {
+      if (_connected_weight[part] == 0) {
+        _adjacent_parts.push_back(part);
+      }
+      _connected_weight[part] += he_weight;
+    }
+
+    const Hypergraph& _hg;
+    const Context& _context;
+    ds::BinaryMaxHeap<HypernodeID, Gain> _pq;
+    ds::FastResetFlagArray<> _updated_neighbours;
+    ds::SparseMap<HypernodeID, PartitionID> _part;
+    ds::SparseMap<HyperedgeID, size_t> _pin_count_delta_offset;
+    std::vector<int32_t> _pin_count_delta;
+    std::vector<HypernodeWeight> _part_weight_delta;
+    std::vector<int32_t> _part_size_delta;
+    std::vector<HyperedgeWeight> _connected_weight;
+    std::vector<PartitionID> _adjacent_parts;
+    std::vector<PartitionID> _local_to_parts;
+    // ! Source and target blocks of all moves of the current search
+    std::vector<PartitionID> _touched_parts;
+    std::vector<SearchMove> _moves;
+    StoppingPolicy _stopping_policy;
+  };
+
+ public:
+  ParallelKWayKMinusOneRefiner(Hypergraph& hypergraph, const Context& context) :
+    _hg(hypergraph),
+    _context(context),
+    _searches(),
+    _claimed_in_round(new std::atomic<uint32_t>[hypergraph.initialNumNodes()]),
+    _round(0),
+    _seeds(),
+    _move_sequence(),
+    _performed_moves(),
+    _imbalance(hypergraph, context) {
+    resetClaims();
+  }
+
+  ~ParallelKWayKMinusOneRefiner() override = default;
+
+  ParallelKWayKMinusOneRefiner(const ParallelKWayKMinusOneRefiner&) = delete;
+  ParallelKWayKMinusOneRefiner& operator= (const ParallelKWayKMinusOneRefiner&) = delete;
+
+  ParallelKWayKMinusOneRefiner(ParallelKWayKMinusOneRefiner&&) = delete;
+  ParallelKWayKMinusOneRefiner& operator= (ParallelKWayKMinusOneRefiner&&) = delete;
+
+ private:
+  FRIEND_TEST(AParallelKWayKMinusOneRefiner, ClaimsEachHypernodeOnlyOncePerRound);
+  FRIEND_TEST(AParallelKWayKMinusOneRefiner, ResetsAllPartDeltasOfRolledBackSearches);
+  FRIEND_TEST(AParallelKWayKMinusOneRefiner, DoesNotClaimHypernodesThatWouldEmptyTheirBlock);
+
+  void initializeImpl(const HyperedgeWeight) override final {
+    _is_initialized = true;
+  }
+
+  bool refineImpl(std::vector<HypernodeID>& refinement_nodes,
+                  const std::array<HypernodeWeight, 2>&,
+                  const UncontractionGainChanges&,
+                  Metrics& best_metrics) override final {
+    HEAVY_REFINEMENT_ASSERT(best_metrics.km1 == metrics::km1(_hg),
+                            V(best_metrics.km1) << V(metrics::km1(_hg)));
+    const HyperedgeWeight initial_km1 = best_metrics.km1;
+    const double initial_imbalance = best_metrics.imbalance;
+
+    startNewRound();
+    collectSeeds(refinement_nodes);
+    performLocalizedSearches();
+    applyMoveSequence(best_metrics);
+
+    HEAVY_REFINEMENT_ASSERT(best_metrics.km1 == metrics::km1(_hg),
+                            V(best_metrics.km1) << V(metrics::km1(_hg)));
+    ASSERT(best_metrics.km1 <= initial_km1, V(initial_km1) << V(best_metrics.km1));
+
+    return FMImprovementPolicy::improvementFound(best_metrics.km1, initial_km1,
+                                                 best_metrics.imbalance, initial_imbalance,
+                                                 _context.partition.epsilon);
+  }
+
+  void collectSeeds(std::vector<HypernodeID>& refinement_nodes) {
+    _seeds.clear();
+    Randomize::instance().shuffleVector(refinement_nodes, refinement_nodes.size());
+    for (const HypernodeID& hn : refinement_nodes) {
+      if (!_hg.isFixedVertex(hn)) {
+        if (_hg.isBorderNode(hn)) {
+          _seeds.push_back(hn);
+        }
+      } else {
+        // Fixed vertices cannot be moved, but their free neighbors can.
+        for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+          for (const HypernodeID& pin : _hg.pins(he)) {
+            if (!_hg.isFixedVertex(pin) && _hg.isBorderNode(pin)) {
+              _seeds.push_back(pin);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void performLocalizedSearches() {
+    _move_sequence.clear();
+    // The number of threads is read here, because the context may be
+    // configured after the refiner was constructed.
+    const size_t num_threads = std::max(std::min(_context.shared_memory.num_threads,
+                                                  _seeds.size() / kMinSeedsPerThread),
+                                        static_cast<size_t>(1));
+    while (_searches.size() < num_threads) {
+      _searches.emplace_back(new LocalizedSearch(_hg, _context));
+    }
+    std::atomic<size_t> next_seed(0);
+    std::mutex move_sequence_mutex;
+    parallel::executeConcurrent(num_threads, [&](const size_t thread_id) {
+        LocalizedSearch& search = *_searches[thread_id];
+        for (size_t i = next_seed++; i < _seeds.size(); i = next_seed++) {
+          if (isClaimed(_seeds[i])) {
+            continue;
+          }
+          const std::vector<SearchMove>& moves = search.search(_seeds[i], *this);
+          if (!moves.empty()) {
+            std::lock_guard<std::mutex> lock(move_sequence_mutex);
+            _move_sequence.insert(_move_sequence.end(), moves.begin(), moves.end());
+          }
+        }
+      });
+  }
+
+  // ! Applies the global move sequence, recalculates the gain of each move and
+  // ! rolls back to the best prefix.
+  void applyMoveSequence(Metrics& best_metrics) {
+    _performed_moves.clear();
+    _imbalance.initialize();
+    HyperedgeWeight current_km1 = best_metrics.km1;
+    int min_km1_index = -1;
+    for (const SearchMove& move : _move_sequence) {
+      ASSERT(_hg.partID(move.hn) == move.from_part, V(move.hn));
+      if (_hg.partSize(move.from_part) - 1 == 0) {
+        continue;
+      }
+      Gain gain = 0;
+      for (const HyperedgeID& he : _hg.incidentEdges(move.hn)) {
+        if (_hg.pinCountInPart(he, move.from_part) == 1) {
+          gain += _hg.edgeWeight(he);
+        }
+        if (_hg.pinCountInPart(he, move.to_part) == 0) {
+          gain -= _hg.edgeWeight(he);
+        }
+      }
+      _hg.changeNodePart(move.hn, move.from_part, move.to_part);
+      _imbalance.update(move.from_part, move.to_part);
+      _performed_moves.emplace_back(RollbackInfo { move.hn, move.from_part, move.to_part });
+      current_km1 -= gain;
+      const double current_imbalance = _imbalance.imbalance();
+
+      HEAVY_REFINEMENT_ASSERT(current_km1 == metrics::km1(_hg),
+                              V(current_km1) << V(metrics::km1(_hg)));
+      HEAVY_REFINEMENT_ASSERT(current_imbalance == metrics::imbalance(_hg, _context),
+                              V(current_imbalance) << V(metrics::imbalance(_hg, _context)));
+
+      // same acceptance criteria as in the sequential k-way FM
+      const bool improved_km1_within_balance = (current_imbalance <= _context.partition.epsilon) &&
+                                               (current_km1 < best_metrics.km1);
+      const bool improved_balance_less_equal_km1 = (current_imbalance < best_metrics.imbalance) &&
+                                                   (current_km1 <= best_metrics.km1);
+      if (improved_km1_within_balance || improved_balance_less_equal_km1) {
+        best_metrics.km1 = current_km1;
+        best_metrics.imbalance = current_imbalance;
+        min_km1_index = _performed_moves.size() - 1;
+      }
+    }
+    DBG << "ParallelKWayFM applied" << _performed_moves.size() << "of"
+        << _move_sequence.size() << "moves ( min_km1_index=" << min_km1_index << ")";
+
+    for (int i = static_cast<int>(_performed_moves.size()) - 1; i > min_km1_index; --i) {
+      _hg.changeNodePart(_performed_moves[i].hn, _performed_moves[i].to_part,
+                         _performed_moves[i].from_part);
+    }
+  }
+
+  // ! Claims hn for the calling search. Returns false if hn has already been
+  // ! claimed by any search in the current round.
+  bool claim(const HypernodeID hn) {
+    uint32_t round = _claimed_in_round[hn].load(std::memory_order_relaxed);
+    return round != _round && _claimed_in_round[hn].compare_exchange_strong(round, _round);
+  }
+
+  bool isClaimed(const HypernodeID hn) const {
+    return _claimed_in_round[hn].load(std::memory_order_relaxed) == _round;
+  }
+
+  void startNewRound() {
+    ++_round;
+    if (_round == 0) {
+      resetClaims();
+      _round = 1;
+    }
+  }
+
+  void resetClaims() {
+    for (HypernodeID hn = 0; hn < _hg.initialNumNodes(); ++hn) {
+      _claimed_in_round[hn].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  Hypergraph& _hg;
+  const Context& _context;
+  std::vector<std::unique_ptr<LocalizedSearch> > _searches;
+  std::unique_ptr<std::atomic<uint32_t>[]> _claimed_in_round;
+  uint32_t _round;
+  std::vector<HypernodeID> _seeds;
+  std::vector<SearchMove> _move_sequence;
+  std::vector<RollbackInfo> _performed_moves;
+  metrics::ImbalanceTracker _imbalance;
+};
+}  // namespace kahypar
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "kahypar/datastructure/bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+#include "kahypar/meta/policy_registry.h"
+#include "kahypar/meta/typelist.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+class PriorityQueuePolicy : public meta::PolicyBase {
+ protected:
+  PriorityQueuePolicy() = default;
+};
+
+// Addressable binary max-heaps: O(log n) updates independent of the gain range.
+class BinaryHeapPriorityQueue : public PriorityQueuePolicy {
+ public:
+  using KWayPQ = ds::KWayPriorityQueue<HypernodeID, Gain, std::numeric_limits<Gain> >;
+
+  // ! The heaps do not depend on max_gain and are only built once.
+  static constexpr bool kDependsOnMaxGain = false;
+
+  static void initialize(KWayPQ& pq, const HypernodeID num_nodes, const HyperedgeWeight,
+                         const Context&) {
+    pq.initialize(num_nodes);
+  }
+};
+
+// Bucket queues with one bucket per possible gain value: O(1) updates, but
+// memory and the cost of finding the next non-empty bucket grow with the gain range.
+// If the gain range of a level is too large, binary heaps are used instead:
+// - FMPriorityQueue::adaptive uses buckets up to fm.max_bucket_queue_gain.
+// - FMPriorityQueue::bucket_queue uses buckets up to kMaxBucketQueueGain, which
+//   only guards against allocating buckets for (saturated) huge gain ranges.
+class BucketPriorityQueue : public PriorityQueuePolicy {
+ public:
+  using KWayPQ = ds::KWayPriorityQueue<HypernodeID, Gain,
+                                       std::numeric_limits<Gain>,
+                                       false,
+                                       ds::BucketQueueWithHeapFallback<HypernodeID,
+                                                                       Gain,
+                                                                       std::numeric_limits<Gain> > >;
+
+  // ! The queues are rebuilt for each max_gain, i.e., for each coarsest level.
+  static constexpr bool kDependsOnMaxGain = true;
+  static constexpr HyperedgeWeight kMaxBucketQueueGain = 1 << 16;
+
+  static void initialize(KWayPQ& pq, const HypernodeID num_nodes, const HyperedgeWeight max_gain,
+                         const Context& context) {
+    pq.initialize(num_nodes, max_gain, maxBucketQueueGain(context));
+  }
+
+  static bool usesBucketQueues(const HyperedgeWeight max_gain, const Context& context) {
+    return max_gain <= maxBucketQueueGain(context);
+  }
+
+ private:
+  static HyperedgeWeight maxBucketQueueGain(const Context& context) {
+    if (context.local_search.fm.priority_queue == FMPriorityQueue::adaptive &&
+        context.local_search.fm.max_bucket_queue_gain < kMaxBucketQueueGain) {
+      return context.local_search.fm.max_bucket_queue_gain;
+    }
+    return kMaxBucketQueueGain;
+  }
+};
+
+using PriorityQueuePolicyClasses = meta::Typelist<BinaryHeapPriorityQueue,
+                                                  BucketPriorityQueue>;
+
+// Returns max_degree * max_he_weight, saturated at the largest HyperedgeWeight.
+// The product is checked via division, because there is no wider type for
+// 64-bit IDs and weights.
+static inline HyperedgeWeight maxGain(const HyperedgeID max_degree,
+                                      const HyperedgeWeight max_he_weight) {
+  constexpr HyperedgeWeight max_weight = std::numeric_limits<HyperedgeWeight>::max();
+  if (max_he_weight > 0 &&
+      static_cast<uint64_t>(max_degree) > static_cast<uint64_t>(max_weight / max_he_weight)) {
+    return max_weight;
+  }
+  return static_cast<HyperedgeWeight>(max_degree) * max_he_weight;
+}
+
+// Upper bound on the absolute gain of a single move, i.e., max. degree * max. hyperedge weight.
+static inline HyperedgeWeight maxGain(const Hypergraph& hypergraph) {
+  HyperedgeID max_degree = 0;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    max_degree = std::max(max_degree, hypergraph.nodeDegree(hn));
+  }
+  HyperedgeWeight max_he_weight = 0;
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    max_he_weight = std::max(max_he_weight, hypergraph.edgeWeight(he));
+  }
+  return maxGain(max_degree, max_he_weight);
+}
+
+// Only bucket queues depend on the maximum gain. If binary heaps are configured,
+// the O(n + m) computation of maxGain() can be skipped.
+static inline bool requiresMaxGain(const Context& context) {
+  return context.local_search.fm.priority_queue != FMPriorityQueue::binary_heap;
+}
+}  // namespace kahypar
@@ -93,7 +93,7 @@ class AdvancedRandomWalkModelStopsSearch : public StoppingPolicy,
  public:
   bool searchShouldStop(const int, const Context& context, const double beta,
                         const HyperedgeWeight, const HyperedgeWeight) {
-    static double factor = (context.local_search.fm.adaptive_stopping_alpha / 2.0) - 0.25;
+    const double factor = (context.local_search.fm.adaptive_stopping_alpha / 2.0) - 0.25;
     DBG << V(_num_steps) << "(" << _variance << "/" << "(" << 4 << "*" << _Mk << "^2)) * "
         << factor << "=" << ((_variance / (_Mk * _Mk)) * factor);
     const bool ret = (_num_steps > beta) &&
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "kahypar/macros.h"
 #include "kahypar/meta/policy_registry.h"
 #include "kahypar/meta/registrar.h"
 
@@ -30,12 +31,15 @@
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/refinement/flow/policies/flow_execution_policy.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 
-#define REGISTER_POLICY(policy, id, policy_class)                                  \
-  static meta::Registrar<meta::PolicyRegistry<policy> > register_ ## policy_class( \
+#define REREGISTER_POLICY(policy, id, policy_class, t)                                    \
+  static meta::Registrar<meta::PolicyRegistry<policy> > JOIN(register_ ## policy_class, t)( \
     id, new policy_class())
 
+#define REGISTER_POLICY(policy, id, policy_class)  REREGISTER_POLICY(policy, id, policy_class, 1)
+
 namespace kahypar {
 // //////////////////////////////////////////////////////////////////////////////
 //                            Rating Functions
@@ -92,6 +96,14 @@ REGISTER_POLICY(RefinementStoppingRule, RefinementStoppingRule::simple,
 REGISTER_POLICY(RefinementStoppingRule, RefinementStoppingRule::adaptive_opt,
                 AdvancedRandomWalkModelStopsSearch);
 
+REGISTER_POLICY(FMPriorityQueue, FMPriorityQueue::binary_heap,
+                BinaryHeapPriorityQueue);
+REGISTER_POLICY(FMPriorityQueue, FMPriorityQueue::bucket_queue,
+                BucketPriorityQueue);
+// The bucket queue policy falls back to binary heaps depending on the mode.
+REREGISTER_POLICY(FMPriorityQueue, FMPriorityQueue::adaptive,
+                  BucketPriorityQueue, 2);
+
 REGISTER_POLICY(FlowExecutionMode, FlowExecutionMode::constant,
                 ConstantFlowExecution);
 REGISTER_POLICY(FlowExecutionMode, FlowExecutionMode::multilevel,
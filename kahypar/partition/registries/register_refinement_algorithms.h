@@ -33,6 +33,8 @@
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_flow_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/parallel_kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 
 #define REGISTER_DISPATCHED_REFINER(id, dispatcher, ...)          \
@@ -59,13 +61,23 @@ namespace kahypar {
 REGISTER_DISPATCHED_REFINER(RefinementAlgorithm::twoway_fm,
                             TwoWayFMFactoryDispatcher,
                             meta::PolicyRegistry<RefinementStoppingRule>::getInstance().getPolicy(
-                              context.local_search.fm.stopping_rule));
+                              context.local_search.fm.stopping_rule),
+                            meta::PolicyRegistry<FMPriorityQueue>::getInstance().getPolicy(
+                              context.local_search.fm.priority_queue));
 REGISTER_DISPATCHED_REFINER(RefinementAlgorithm::kway_fm,
                             KWayFMFactoryDispatcher,
                             meta::PolicyRegistry<RefinementStoppingRule>::getInstance().getPolicy(
-                              context.local_search.fm.stopping_rule));
+                              context.local_search.fm.stopping_rule),
+                            meta::PolicyRegistry<FMPriorityQueue>::getInstance().getPolicy(
+                              context.local_search.fm.priority_queue));
 REGISTER_DISPATCHED_REFINER(RefinementAlgorithm::kway_fm_km1,
                             KWayKMinusOneFactoryDispatcher,
+                            meta::PolicyRegistry<RefinementStoppingRule>::getInstance().getPolicy(
+                              context.local_search.fm.stopping_rule),
+                            meta::PolicyRegistry<FMPriorityQueue>::getInstance().getPolicy(
+                              context.local_search.fm.priority_queue));
+REGISTER_DISPATCHED_REFINER(RefinementAlgorithm::parallel_kway_fm_km1,
+                            ParallelKWayKMinusOneFactoryDispatcher,
                             meta::PolicyRegistry<RefinementStoppingRule>::getInstance().getPolicy(
                               context.local_search.fm.stopping_rule));
 
@@ -19,11 +19,14 @@
  ******************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -121,6 +124,10 @@ class PartitionerFacade {
       std::exit(0);
     }
 
+    if (context.shared_memory.num_threads > 1) {
+      return performParallelTimeLimitedRepeatedPartitioning(hypergraph, context);
+    }
+
     size_t iteration = 0;
     std::chrono::duration<double> elapsed_time(0);
 
@@ -165,6 +172,99 @@ class PartitionerFacade {
     return iteration;
   }
 
+  /*!
+   * Parallel version of time limited repeated partitioning:
+   * Each worker thread owns a private copy of the hypergraph and the context as well
+   * as its own random number generator. All workers repeatedly partition their copy
+   * until the time limit is reached and race to improve a shared best solution.
+   */
+  size_t performParallelTimeLimitedRepeatedPartitioning(Hypergraph& hypergraph,
+                                                        Context& context) {
+    const size_t num_threads = context.shared_memory.num_threads;
+
+    std::vector<PartitionID> best_solution(hypergraph.initialNumNodes(), 0);
+    HyperedgeWeight best_solution_quality = std::numeric_limits<HyperedgeWeight>::max();
+    double best_imbalance = 1.0;
+    std::atomic<size_t> iteration(0);
+    std::mutex best_solution_mutex;
+    Timer& main_timer = Timer::instance();
+
+    auto worker = [&](const size_t thread_id) {
+        Hypergraph worker_hypergraph = ds::copyHypergraph(hypergraph);
+        Context worker_context(context);
+        worker_context.stats.detachFromParent();
+        worker_context.partition.quiet_mode = true;
+        worker_context.partition.verbose_output = false;
+        worker_context.partition.sp_process_output = false;
+        worker_context.initial_partitioning.verbose_output = false;
+        // The workers already occupy all threads, so each repetition runs sequentially.
+        worker_context.shared_memory.num_threads = 1;
+        // Thread 0 uses the original seed such that a single worker reproduces the
+        // sequential results. All other workers get their own seed stream.
+        Randomize::instance().setSeed(context.partition.seed + static_cast<int>(thread_id));
+
+        Partitioner partitioner;
+        std::chrono::duration<double> elapsed_time(0);
+        while (elapsed_time.count() < context.partition.time_limit) {
+          const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+          partitioner.partition(worker_hypergraph, worker_context);
+          const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+
+          elapsed_time += std::chrono::duration<double>(end - start);
+
+          const HyperedgeWeight current_solution_quality =
+            kahypar::metrics::correctMetric(worker_hypergraph, worker_context);
+          const double current_imbalance = kahypar::metrics::imbalance(worker_hypergraph,
+                                                                       worker_context);
+          const size_t current_iteration = iteration++;
+          {
+            std::lock_guard<std::mutex> lock(best_solution_mutex);
+            const bool improved_quality = current_solution_quality < best_solution_quality;
+            const bool improved_imbalance = (current_solution_quality == best_solution_quality) &&
+                                            (current_imbalance < best_imbalance);
+
+            if (improved_quality || improved_imbalance) {
+              best_solution_quality = current_solution_quality;
+              best_imbalance = current_imbalance;
+              for (const auto& hn : worker_hypergraph.nodes()) {
+                best_solution[hn] = worker_hypergraph.partID(hn);
+              }
+            }
+
+            // Output is only enabled while holding the lock to avoid interleaved results.
+            worker_context.partition.quiet_mode = context.partition.quiet_mode;
+            worker_context.partition.sp_process_output = context.partition.sp_process_output;
+            io::printPartitioningResults(worker_hypergraph, worker_context, elapsed_time);
+            io::serializer::serialize(worker_context, worker_hypergraph, elapsed_time,
+                                      current_iteration);
+            worker_context.partition.quiet_mode = true;
+            worker_context.partition.sp_process_output = false;
+          }
+
+          worker_hypergraph.reset();
+        }
+        std::lock_guard<std::mutex> lock(best_solution_mutex);
+        main_timer.merge(Timer::instance());
+      };
+
+    std::vector<std::thread> workers;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+      workers.emplace_back(worker, thread_id);
+    }
+    for (std::thread& thread : workers) {
+      thread.join();
+    }
+
+    // Only the private contexts of the workers have been set up so far,
+    // but the final output needs the part weights.
+    context.setupPartWeights(hypergraph.totalWeight());
+    hypergraph.reset();
+    for (const auto& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, best_solution[hn]);
+    }
+    return iteration;
+  }
+
   void performEvolutionaryPartitioning(Hypergraph& hypergraph, Context& context) {
     EvoPartitioner evo_partitioner(context);
     evo_partitioner.partition(hypergraph, context);
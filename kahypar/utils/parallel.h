@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace kahypar {
+namespace parallel {
+// ! Number of hardware threads (at least 1).
+static inline size_t hardwareConcurrency() {
+  return std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                  static_cast<size_t>(1));
+}
+
+// ! Executes f(thread_id) for thread_id in [0, num_threads).
+// ! The calling thread executes thread_id = 0.
+template <typename F>
+static inline void executeConcurrent(const size_t num_threads, F&& f) {
+  if (num_threads <= 1) {
+    f(static_cast<size_t>(0));
+    return;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t thread_id = 1; thread_id < num_threads; ++thread_id) {
+    threads.emplace_back([&f, thread_id]() {
+        f(thread_id);
+      });
+  }
+  f(static_cast<size_t>(0));
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// ! Splits [begin, end) into num_threads contiguous blocks of (almost) equal
+// ! size and executes f(thread_id, block_begin, block_end) for each block.
+template <typename F>
+static inline void parallelForBlocks(const size_t begin, const size_t end,
+                                     const size_t num_threads, F&& f) {
+  if (end <= begin) {
+    return;
+  }
+  const size_t threads = std::min(std::max(num_threads, static_cast<size_t>(1)), end - begin);
+  const size_t block_size = (end - begin + threads - 1) / threads;
+  executeConcurrent(threads, [&](const size_t thread_id) {
+      const size_t block_begin = std::min(begin + thread_id * block_size, end);
+      const size_t block_end = std::min(block_begin + block_size, end);
+      f(thread_id, block_begin, block_end);
+    });
+}
+
+// ! Executes f(i) for all i in [begin, end). The range is split into
+// ! num_threads contiguous blocks of (almost) equal size.
+template <typename F>
+static inline void parallelFor(const size_t begin, const size_t end,
+                               const size_t num_threads, F&& f) {
+  parallelForBlocks(begin, end, num_threads,
+                    [&](const size_t, const size_t block_begin, const size_t block_end) {
+      for (size_t i = block_begin; i < block_end; ++i) {
+        f(i);
+      }
+    });
+}
+
+// ! Sorts [begin, end) according to comp. The blocks of parallelForBlocks are
+// ! sorted concurrently and afterwards merged pairwise in log(num_threads) rounds.
+template <typename RandomIt, typename Compare>
+static inline void sort(const RandomIt begin, const RandomIt end,
+                        const size_t num_threads, Compare comp) {
+  const size_t size = end - begin;
+  const size_t threads = std::min(std::max(num_threads, static_cast<size_t>(1)), size);
+  if (threads <= 1) {
+    std::sort(begin, end, comp);
+    return;
+  }
+  parallelForBlocks(0, size, threads,
+                    [&](const size_t, const size_t block_begin, const size_t block_end) {
+      std::sort(begin + block_begin, begin + block_end, comp);
+    });
+  for (size_t width = (size + threads - 1) / threads; width < size; width *= 2) {
+    const size_t num_merges = (size + 2 * width - 1) / (2 * width);
+    parallelFor(0, num_merges, threads, [&](const size_t i) {
+        const size_t merge_begin = i * 2 * width;
+        const size_t merge_middle = std::min(merge_begin + width, size);
+        const size_t merge_end = std::min(merge_begin + 2 * width, size);
+        std::inplace_merge(begin + merge_begin, begin + merge_middle, begin + merge_end, comp);
+      });
+  }
+}
+
+/*!
+ * Work-stealing pool for tasks that recursively spawn new tasks.
+ *
+ * Each thread owns a deque of tasks. Spawned tasks are pushed to the back
+ * of the deque of the spawning thread, which also takes its next task from
+ * the back (depth-first). Idle threads steal from the front of the deques
+ * of other threads, i.e., they take the oldest and usually largest tasks.
+ * run() returns as soon as all tasks (including all transitively spawned
+ * tasks) are finished. Threads that find no task to execute block until a
+ * new task is spawned or all tasks are finished.
+ */
+class TaskPool {
+ public:
+  // ! A task is called with the id of the thread that executes it.
+  using Task = std::function<void(const size_t)>;
+
+  explicit TaskPool(const size_t num_threads) :
+    _num_threads(std::max(num_threads, static_cast<size_t>(1))),
+    _queues(new Queue[_num_threads]),
+    _num_pending_tasks(0),
+    _num_queued_tasks(0),
+    _mutex(),
+    _task_available() { }
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator= (const TaskPool&) = delete;
+
+  TaskPool(TaskPool&&) = delete;
+  TaskPool& operator= (TaskPool&&) = delete;
+
+  ~TaskPool() = default;
+
+  size_t numThreads() const {
+    return _num_threads;
+  }
+
+  // ! Adds a task to the deque of thread thread_id. Tasks spawned before
+  // ! run() is called should use thread_id = 0.
+  void spawn(const size_t thread_id, Task task) {
+    ++_num_pending_tasks;
+    {
+      Queue& queue = _queues[thread_id];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+      ++_num_queued_tasks;
+    }
+    notify(false);
+  }
+
+  // ! Executes all tasks. The calling thread executes thread_id = 0.
+  void run() {
+    executeConcurrent(_num_threads, [&](const size_t thread_id) {
+        Task task;
+        while (_num_pending_tasks.load() > 0) {
+          if (popLocal(thread_id, task) || steal(thread_id, task)) {
+            task(thread_id);
+            task = nullptr;
+            if (--_num_pending_tasks == 0) {
+              notify(true);
+            }
+          } else {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _task_available.wait(lock, [&]() {
+                return _num_queued_tasks.load() > 0 || _num_pending_tasks.load() == 0;
+              });
+          }
+        }
+      });
+  }
+
+ private:
+  struct Queue {
+    Queue() :
+      mutex(),
+      tasks() { }
+
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // Taking the mutex before notifying ensures that a thread that just evaluated
+  // the wait condition is already waiting and does not miss the notification.
+  void notify(const bool all) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+    }
+    if (all) {
+      _task_available.notify_all();
+    } else {
+      _task_available.notify_one();
+    }
+  }
+
+  bool popLocal(const size_t thread_id, Task& task) {
+    Queue& queue = _queues[thread_id];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    --_num_queued_tasks;
+    return true;
+  }
+
+  bool steal(const size_t thread_id, Task& task) {
+    for (size_t i = 1; i < _num_threads; ++i) {
+      Queue& queue = _queues[(thread_id + i) % _num_threads];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        --_num_queued_tasks;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const size_t _num_threads;
+  std::unique_ptr<Queue[]> _queues;
+  std::atomic<size_t> _num_pending_tasks;
+  // ! Number of tasks that are spawned but not yet taken by a thread
+  std::atomic<size_t> _num_queued_tasks;
+  std::mutex _mutex;
+  std::condition_variable _task_available;
+};
+}  // namespace parallel
+}  // namespace kahypar
@@ -34,8 +34,10 @@ class Randomize {
   Randomize& operator= (const Randomize&) = delete;
   Randomize& operator= (Randomize&&) = delete;
 
+  // ! Each thread owns its own generator, so that concurrently running
+  // ! partitioners do not share (and race on) a single random stream.
   static Randomize & instance() {
-    static Randomize instance;
+    static thread_local Randomize instance;
     return instance;
   }
 
@@ -87,6 +87,17 @@ class Stats {
     _logs[static_cast<size_t>(tag)][key] = value;
   }
 
+  // ! Turns these stats into top-level stats that are not reported to the parent.
+  // ! Used for contexts that live on a different thread than their parent.
+  void detachFromParent() {
+    _parent = nullptr;
+  }
+
+  // ! Adds the serialized stats of detached stats, e.g. after their thread finished.
+  void addSerialized(const std::string& serialized) {
+    parentOutputStream() << serialized;
+  }
+
   Stats & topLevel() {
     if (_parent != nullptr) {
       return *_parent;
@@ -110,11 +110,19 @@ class Timer {
     _timings.emplace_back(context, timepoint, time);
   }
 
+  // ! Timings are collected per thread. Use Timer::merge to combine the
+  // ! timings of worker threads.
   static Timer & instance() {
-    static Timer instance;
+    static thread_local Timer instance;
     return instance;
   }
 
+  void merge(const Timer& other) {
+    _timings.insert(_timings.end(), other._timings.begin(), other._timings.end());
+    _evaluated = false;
+    _result = Result { };
+  }
+
   void clear() {
     _timings.clear();
     _evaluated = false;
@@ -81,6 +81,12 @@ void kahypar_set_context_partition_time_limit(kahypar_context_t* kahypar_context
   context.partition.time_limit = time_limit;
 }
 
+void kahypar_set_context_partition_time_limited_repeated_partitioning(kahypar_context_t* kahypar_context,
+								      bool time_limited_repeated_partitioning) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.partition.time_limited_repeated_partitioning = time_limited_repeated_partitioning;
+}
+
 void kahypar_set_context_partition_max_part_weights(kahypar_context_t* kahypar_context,
 						    std::vector<kahypar::HypernodeWeight>& max_part_weights) {
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);  
@@ -148,6 +154,48 @@ void kahypar_set_context_partition_input_partition_filename(kahypar_context_t* k
   context.partition.input_partition_filename = input_partition_filename;
 }
 
+void kahypar_set_context_shared_memory_num_threads(kahypar_context_t* kahypar_context,
+						   size_t num_threads) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.num_threads = num_threads == 0 ? 1 : num_threads;
+}
+
+void kahypar_set_context_shared_memory_parallel_recursive_bisection(kahypar_context_t* kahypar_context,
+								    bool parallel_recursive_bisection) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_recursive_bisection = parallel_recursive_bisection;
+}
+
+void kahypar_set_context_shared_memory_parallel_initial_partitioning_pool(kahypar_context_t* kahypar_context,
+									  bool parallel_initial_partitioning_pool) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_initial_partitioning_pool = parallel_initial_partitioning_pool;
+}
+
+void kahypar_set_context_shared_memory_parallel_community_detection(kahypar_context_t* kahypar_context,
+								    bool parallel_community_detection) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_community_detection = parallel_community_detection;
+}
+
+void kahypar_set_context_shared_memory_parallel_min_hash_sparsifier(kahypar_context_t* kahypar_context,
+								    bool parallel_min_hash_sparsifier) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_min_hash_sparsifier = parallel_min_hash_sparsifier;
+}
+
+void kahypar_set_context_shared_memory_parallel_deduplication(kahypar_context_t* kahypar_context,
+							      bool parallel_deduplication) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_deduplication = parallel_deduplication;
+}
+
+void kahypar_set_context_shared_memory_parallel_flow_refinement(kahypar_context_t* kahypar_context,
+								bool parallel_flow_refinement) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.shared_memory.parallel_flow_refinement = parallel_flow_refinement;
+}
+
 void kahypar_set_context_preprocessing_enable_min_hash_sparsifier(kahypar_context_t* kahypar_context,
 								  bool enable_min_hash_sparsifier) {
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);  
@@ -232,6 +280,12 @@ void kahypar_set_context_preprocessing_community_detection_min_eps_improvement(k
   context.preprocessing.community_detection.min_eps_improvement = min_eps_improvement;
 }
 
+void kahypar_set_context_preprocessing_community_detection_stream_bipartite_graph(kahypar_context_t* kahypar_context,
+										  bool stream_bipartite_graph) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.preprocessing.community_detection.stream_bipartite_graph = stream_bipartite_graph;
+}
+
 // Context.CoarseningParameters
 void kahypar_set_context_coarsening_algorithm(kahypar_context_t* kahypar_context,
 					      const char* ctype) {
@@ -251,6 +305,12 @@ void kahypar_set_context_coarsening_max_allowed_weight_multiplier(kahypar_contex
   context.coarsening.max_allowed_weight_multiplier = max_allowed_weight_multiplier;
 }
 
+void kahypar_set_context_coarsening_remove_parallel_hes_per_pass(kahypar_context_t* kahypar_context,
+								 bool remove_parallel_hes_per_pass) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.coarsening.remove_parallel_hes_per_pass = remove_parallel_hes_per_pass;
+}
+
 void kahypar_set_context_coarsening_RP_rating_function(kahypar_context_t* kahypar_context,
 						       const char* rating_score) {
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
@@ -299,6 +359,13 @@ void kahypar_set_context_local_search_iterations_per_level(kahypar_context_t* ka
   }
 }
 
+void kahypar_set_context_local_search_uncontraction_batch_size(kahypar_context_t* kahypar_context,
+							       size_t uncontraction_batch_size) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.local_search.uncontraction_batch_size =
+    uncontraction_batch_size == 0 ? 1 : uncontraction_batch_size;
+}
+
 void kahypar_set_context_local_search_fm_max_number_of_fruitless_moves(kahypar_context_t* kahypar_context,
 								       uint32_t max_number_of_fruitless_moves) {
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
@@ -317,6 +384,18 @@ void kahypar_set_context_local_search_fm_stopping_rule(kahypar_context_t* kahypa
   context.local_search.fm.stopping_rule = kahypar::stoppingRuleFromString(stopfm);
 }
 
+void kahypar_set_context_local_search_fm_priority_queue(kahypar_context_t* kahypar_context,
+							const char* pq) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.local_search.fm.priority_queue = kahypar::fmPriorityQueueFromString(pq);
+}
+
+void kahypar_set_context_local_search_fm_max_bucket_queue_gain(kahypar_context_t* kahypar_context,
+							       kahypar_hyperedge_weight_t max_bucket_queue_gain) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  context.local_search.fm.max_bucket_queue_gain = max_bucket_queue_gain;
+}
+
 void kahypar_set_context_local_search_execution_policy(kahypar_context_t* kahypar_context,
 						       const char* ftype) {
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
@@ -464,9 +543,7 @@ void kahypar_set_custom_target_block_weights(const kahypar_partition_id_t num_bl
   kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
   context.partition.use_individual_part_weights = true;
 
-  for (kahypar_partition_id_t i = 0; i != num_blocks; ++i) {
-    context.partition.max_part_weights.push_back(block_weights[i]);
-  }
+  context.partition.max_part_weights.assign(block_weights, block_weights + num_blocks);
 }
 
 void kahypar_context_free(kahypar_context_t* kahypar_context) {
@@ -476,6 +553,67 @@ void kahypar_context_free(kahypar_context_t* kahypar_context) {
   delete reinterpret_cast<kahypar::Context*>(kahypar_context);
 }
 
+void kahypar_read_hypergraph_from_file(const char* file_name,
+                                       kahypar_hypernode_id_t* num_vertices,
+                                       kahypar_hyperedge_id_t* num_hyperedges,
+                                       size_t** hyperedge_indices,
+                                       kahypar_hyperedge_id_t** hyperedges,
+                                       kahypar_hyperedge_weight_t** hyperedge_weights,
+                                       kahypar_hypernode_weight_t** vertex_weights) {
+  std::unique_ptr<size_t[]> indices_ptr(nullptr);
+  std::unique_ptr<kahypar::HypernodeID[]> hyperedges_ptr(nullptr);
+  std::unique_ptr<kahypar::HyperedgeWeight[]> hyperedge_weights_ptr(nullptr);
+  std::unique_ptr<kahypar::HypernodeWeight[]> vertex_weights_ptr(nullptr);
+
+  kahypar::io::readHypergraphFile(file_name, *num_vertices, *num_hyperedges,
+                                  indices_ptr, hyperedges_ptr,
+                                  hyperedge_weights_ptr, vertex_weights_ptr);
+
+  // Ownership is transferred to the caller, who has to release the arrays via delete[].
+  *hyperedge_indices = indices_ptr.release();
+  *hyperedges = hyperedges_ptr.release();
+  *hyperedge_weights = hyperedge_weights_ptr.release();
+  *vertex_weights = vertex_weights_ptr.release();
+}
+
+namespace {
+// The context passed by the user is never modified. Each call works on a private copy
+// instead, such that the same context can be used by multiple concurrent calls.
+// Since the random number generator and the timer are thread-local, concurrent calls
+// on different threads do not share any mutable state.
+void partitionHypergraph(kahypar::Hypergraph& hypergraph,
+                         const double epsilon,
+                         const kahypar_partition_id_t num_blocks,
+                         kahypar_hyperedge_weight_t* objective,
+                         const kahypar::Context& user_context,
+                         kahypar_partition_id_t* partition) {
+  ASSERT(!user_context.partition.use_individual_part_weights ||
+         !user_context.partition.max_part_weights.empty());
+  ASSERT(partition != nullptr);
+
+  kahypar::Context context(user_context);
+  context.stats.detachFromParent();
+  context.partition.k = num_blocks;
+  context.partition.epsilon = epsilon;
+  context.partition.write_partition_file = false;
+
+  if (context.partition.vcycle_refinement_for_input_partition) {
+    for (const auto hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, partition[hn]);
+    }
+  }
+
+  kahypar::PartitionerFacade partitioner;
+  partitioner.partition(hypergraph, context);
+
+  *objective = kahypar::metrics::correctMetric(hypergraph, context);
+
+  for (const auto hn : hypergraph.nodes()) {
+    partition[hn] = hypergraph.partID(hn);
+  }
+}
+}  // namespace
+
 void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
                        const kahypar_hyperedge_id_t num_hyperedges,
                        const double epsilon,
@@ -487,41 +625,63 @@ void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
                        kahypar_hyperedge_weight_t* objective,
                        kahypar_context_t* kahypar_context,
                        kahypar_partition_id_t* partition) {
-  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
-  ASSERT(!context.partition.use_individual_part_weights ||
-         !context.partition.max_part_weights.empty());
-  ASSERT(partition != nullptr);
-
-  context.partition.k = num_blocks;
-  context.partition.epsilon = epsilon;
-  context.partition.write_partition_file = false;
-
   kahypar::Hypergraph hypergraph(num_vertices,
                                  num_hyperedges,
                                  hyperedge_indices,
                                  hyperedges,
-                                 context.partition.k,
+                                 num_blocks,
                                  hyperedge_weights,
                                  vertex_weights);
 
-  if (context.partition.vcycle_refinement_for_input_partition) {
-    for (const auto hn : hypergraph.nodes()) {
-      hypergraph.setNodePart(hn, partition[hn]);
-    }
-  }
-
-  kahypar::PartitionerFacade partitioner;
-  partitioner.partition(hypergraph, context);
+  partitionHypergraph(hypergraph, epsilon, num_blocks, objective,
+                      *reinterpret_cast<const kahypar::Context*>(kahypar_context), partition);
+}
 
-  *objective = kahypar::metrics::correctMetric(hypergraph, context);
+kahypar_hypergraph_t* kahypar_create_hypergraph(const kahypar_partition_id_t num_blocks,
+                                                const kahypar_hypernode_id_t num_vertices,
+                                                const kahypar_hyperedge_id_t num_hyperedges,
+                                                const size_t* hyperedge_indices,
+                                                const kahypar_hyperedge_id_t* hyperedges,
+                                                const kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                const kahypar_hypernode_weight_t* vertex_weights) {
+  return reinterpret_cast<kahypar_hypergraph_t*>(new kahypar::Hypergraph(num_vertices,
+                                                                         num_hyperedges,
+                                                                         hyperedge_indices,
+                                                                         hyperedges,
+                                                                         num_blocks,
+                                                                         hyperedge_weights,
+                                                                         vertex_weights));
+}
 
-  for (const auto hn : hypergraph.nodes()) {
-    partition[hn] = hypergraph.partID(hn);
+void kahypar_hypergraph_free(kahypar_hypergraph_t* kahypar_hypergraph) {
+  if (kahypar_hypergraph == nullptr) {
+    return;
+  }
+  delete reinterpret_cast<kahypar::Hypergraph*>(kahypar_hypergraph);
+}
+
+void kahypar_partition_hypergraph(kahypar_hypergraph_t* kahypar_hypergraph,
+                                  const kahypar_partition_id_t num_blocks,
+                                  const double epsilon,
+                                  kahypar_hyperedge_weight_t* objective,
+                                  kahypar_context_t* kahypar_context,
+                                  kahypar_partition_id_t* partition) {
+  ASSERT(kahypar_hypergraph != nullptr);
+  kahypar::Hypergraph& hypergraph = *reinterpret_cast<kahypar::Hypergraph*>(kahypar_hypergraph);
+
+  // Partitioning restores the input hypergraph, but leaves the partition (and the
+  // communities used during coarsening) behind. Resizing the partition-related data
+  // structures is only necessary if the number of blocks changed. Fixed vertices are
+  // read from the fixed vertex file of the context on each call, so the fixed vertices
+  // of the previous call have to be removed (before their blocks may become invalid).
+  hypergraph.resetFixedVertices();
+  if (hypergraph.k() != static_cast<kahypar::PartitionID>(num_blocks)) {
+    hypergraph.changeK(num_blocks);
   }
+  hypergraph.reset();
 
-  context.partition.perfect_balance_part_weights.clear();
-  context.partition.max_part_weights.clear();
-  context.evolutionary.communities.clear();
+  partitionHypergraph(hypergraph, epsilon, num_blocks, objective,
+                      *reinterpret_cast<const kahypar::Context*>(kahypar_context), partition);
 }
 
 
@@ -538,7 +698,8 @@ void kahypar_improve_partition(const kahypar_hypernode_id_t num_vertices,
                                kahypar_hyperedge_weight_t* objective,
                                kahypar_context_t* kahypar_context,
                                kahypar_partition_id_t* improved_partition) {
-  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  kahypar::Context context(*reinterpret_cast<const kahypar::Context*>(kahypar_context));
+  context.stats.detachFromParent();
   ALWAYS_ASSERT(context.partition.mode == kahypar::Mode::direct_kway,
                 "V-cycle refinement of input partitions is only possible in direct k-way mode");
   ASSERT(*std::max_element(input_partition, input_partition + num_vertices) == num_blocks - 1);
@@ -563,15 +724,13 @@ void kahypar_improve_partition(const kahypar_hypernode_id_t num_vertices,
   // use improved_partition as temporary_input_partition
   std::memcpy(improved_partition, input_partition, num_vertices * sizeof(kahypar_partition_id_t));
 
-  kahypar_partition(num_vertices,
-                    num_hyperedges,
-                    epsilon,
-                    num_blocks,
-                    vertex_weights,
-                    hyperedge_weights,
-                    hyperedge_indices,
-                    hyperedges,
-                    objective,
-                    kahypar_context,
-                    improved_partition);
+  kahypar::Hypergraph hypergraph(num_vertices,
+                                 num_hyperedges,
+                                 hyperedge_indices,
+                                 hyperedges,
+                                 num_blocks,
+                                 hyperedge_weights,
+                                 vertex_weights);
+
+  partitionHypergraph(hypergraph, epsilon, num_blocks, objective, context, improved_partition);
 }
@@ -19,6 +19,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <numeric>
 #include <set>
 #include <vector>
@@ -257,6 +258,129 @@ TEST_F(ABipartiteGraph, ReturnCorrectContractedGraph) {
   }
 }
 
+TEST_F(ABipartiteGraph, ContractsClustersInParallelAsSequentially) {
+  graph->setClusterID(2, 0);
+  graph->setClusterID(7, 0);
+  graph->setClusterID(1, 3);
+  graph->setClusterID(4, 3);
+  graph->setClusterID(8, 3);
+  graph->setClusterID(9, 3);
+  graph->setClusterID(5, 6);
+  graph->setClusterID(10, 6);
+  auto sequential = graph->contractClusters();
+  auto parallel = graph->contractClusters(3);
+
+  ASSERT_EQ(sequential.second, parallel.second);
+  ASSERT_EQ(sequential.first.numNodes(), parallel.first.numNodes());
+  ASSERT_EQ(sequential.first.numEdges(), parallel.first.numEdges());
+  for (const NodeID& node : sequential.first.nodes()) {
+    ASSERT_EQ(sequential.first.degree(node), parallel.first.degree(node));
+    auto parallel_edge = parallel.first.firstEdge(node);
+    for (const Edge& e : sequential.first.incidentEdges(node)) {
+      ASSERT_EQ(e.target_node, parallel_edge->target_node);
+      ASSERT_EQ(e.weight, parallel_edge->weight);
+      ++parallel_edge;
+    }
+  }
+}
+
+TEST_F(ABipartiteGraph, IsEquivalentToItsBipartiteGraphView) {
+  for (const LouvainEdgeWeight edge_weight : { LouvainEdgeWeight::degree,
+                                               LouvainEdgeWeight::non_uniform,
+                                               LouvainEdgeWeight::uniform }) {
+    context.preprocessing.community_detection.edge_weight = edge_weight;
+    Graph materialized(hypergraph, context);
+    context.preprocessing.community_detection.stream_bipartite_graph = true;
+    Graph view(hypergraph, context);
+    context.preprocessing.community_detection.stream_bipartite_graph = false;
+
+    ASSERT_FALSE(materialized.isBipartiteGraphView());
+    ASSERT_TRUE(view.isBipartiteGraphView());
+    ASSERT_EQ(materialized.numNodes(), view.numNodes());
+    ASSERT_EQ(materialized.numEdges(), view.numEdges());
+    ASSERT_EQ(materialized.totalWeight(), view.totalWeight());
+    for (const NodeID& node : materialized.nodes()) {
+      ASSERT_EQ(materialized.degree(node), view.degree(node));
+      ASSERT_EQ(materialized.weightedDegree(node), view.weightedDegree(node));
+      std::vector<std::pair<NodeID, EdgeWeight> > view_edges;
+      view.forEachIncidentEdge(node, [&](const Edge& e) {
+          view_edges.emplace_back(e.target_node, e.weight);
+        });
+      auto view_edge = view_edges.cbegin();
+      for (const Edge& e : materialized.incidentEdges(node)) {
+        ASSERT_EQ(e.target_node, view_edge->first);
+        ASSERT_EQ(e.weight, view_edge->second);
+        ++view_edge;
+      }
+    }
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      ASSERT_EQ(materialized.hypernodeClusterID(hn), view.hypernodeClusterID(hn));
+    }
+  }
+}
+
+TEST_F(ABipartiteGraph, StopsIteratingOverIncidentEdgesAtTheFirstMatch) {
+  context.preprocessing.community_detection.stream_bipartite_graph = true;
+  Graph view(hypergraph, context);
+  for (const Graph* g : { static_cast<const Graph*>(graph.get()),
+                          static_cast<const Graph*>(&view) }) {
+    for (const NodeID& node : g->nodes()) {
+      std::vector<NodeID> targets;
+      g->forEachIncidentEdge(node, [&](const Edge& e) {
+          targets.push_back(e.target_node);
+        });
+
+      size_t visited = 0;
+      ASSERT_FALSE(g->forEachIncidentEdgeUntil(node, [&](const Edge&) {
+          ++visited;
+          return false;
+        }));
+      ASSERT_EQ(visited, targets.size());
+      if (targets.empty()) {
+        continue;
+      }
+
+      const NodeID first_match = targets.back();
+      visited = 0;
+      ASSERT_TRUE(g->forEachIncidentEdgeUntil(node, [&](const Edge& e) {
+          ++visited;
+          return e.target_node == first_match;
+        }));
+      ASSERT_EQ(visited, static_cast<size_t>(std::find(targets.begin(), targets.end(), first_match) -
+                                             targets.begin()) + 1);
+    }
+  }
+}
+
+TEST_F(ABipartiteGraph, ViewIsContractedToTheSameGraphAsTheMaterializedGraph) {
+  context.preprocessing.community_detection.stream_bipartite_graph = true;
+  Graph view(hypergraph, context);
+  for (Graph* g : { graph.get(), &view }) {
+    g->setClusterID(2, 0);
+    g->setClusterID(7, 0);
+    g->setClusterID(1, 3);
+    g->setClusterID(4, 3);
+    g->setClusterID(8, 3);
+    g->setClusterID(9, 3);
+    g->setClusterID(5, 6);
+    g->setClusterID(10, 6);
+  }
+  auto materialized_contraction = graph->contractClusters();
+  auto view_contraction = view.contractClusters();
+
+  ASSERT_FALSE(view_contraction.first.isBipartiteGraphView());
+  ASSERT_EQ(materialized_contraction.second, view_contraction.second);
+  ASSERT_EQ(materialized_contraction.first.numEdges(), view_contraction.first.numEdges());
+  for (const NodeID& node : materialized_contraction.first.nodes()) {
+    auto view_edge = view_contraction.first.firstEdge(node);
+    for (const Edge& e : materialized_contraction.first.incidentEdges(node)) {
+      ASSERT_EQ(e.target_node, view_edge->target_node);
+      ASSERT_EQ(e.weight, view_edge->weight);
+      ++view_edge;
+    }
+  }
+}
+
 TEST_F(ABipartiteGraph, HasCorrectSelfloopWeights) {
   graph->setClusterID(2, 0);
   graph->setClusterID(7, 0);
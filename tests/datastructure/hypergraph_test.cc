@@ -129,13 +129,13 @@ TEST_F(AHypergraph, DecrementsNumberOfPinsOnHyperedgeRemoval) {
 }
 
 TEST_F(AHypergraph, DecrementsHypernodeDegreeOfAffectedHypernodesOnHyperedgeRemoval) {
-  ASSERT_THAT(hypergraph.hypernode(3).size(), Eq(2));
-  ASSERT_THAT(hypergraph.hypernode(4).size(), Eq(2));
-  ASSERT_THAT(hypergraph.hypernode(6).size(), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(3), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(4), Eq(2));
+  ASSERT_THAT(hypergraph.nodeDegree(6), Eq(2));
   hypergraph.removeEdge(2);
-  ASSERT_THAT(hypergraph.hypernode(3).size(), Eq(1));
-  ASSERT_THAT(hypergraph.hypernode(4).size(), Eq(1));
-  ASSERT_THAT(hypergraph.hypernode(6).size(), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(3), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(4), Eq(1));
+  ASSERT_THAT(hypergraph.nodeDegree(6), Eq(1));
 }
 
 TEST_F(AHypergraph, InvalidatesContractedHypernode) {
@@ -457,7 +457,7 @@ TEST_F(AHypergraph, InvalidatesPartitionPinCountsOnHyperedgeRemoval) {
 
   for (PartitionID part = 0; part < hypergraph._k; ++part) {
     // bypass pinCountInPart because of assertions
-    const HypernodeID num_pins = hypergraph._pins_in_part[1 * hypergraph._k + part];
+    const HypernodeID num_pins = hypergraph._pins_in_part.get(1, part);
     ASSERT_THAT(num_pins, Eq(hypergraph.kInvalidCount));
   }
 }
@@ -812,6 +812,19 @@ TEST_F(APartitionedHypergraph, CanBeResetToUnpartitionedState) {
 }
 
 
+TEST_F(APartitionedHypergraph, CanBeCopiedIncludingPartitionInfo) {
+  hypergraph.initializeNumCutHyperedges();
+  Hypergraph copy = copyHypergraph(hypergraph);
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(hypergraph, copy), Eq(true));
+}
+
+TEST_F(APartitionedHypergraph, IsIndependentOfItsCopy) {
+  Hypergraph copy = copyHypergraph(hypergraph);
+  copy.changeNodePart(1, 0, 1);
+  ASSERT_THAT(hypergraph.partID(1), Eq(0));
+  ASSERT_THAT(copy.partID(1), Eq(1));
+}
+
 TEST_F(APartitionedHypergraph, IdentifiesBorderHypernodes) {
   hypergraph.initializeNumCutHyperedges();
   ASSERT_THAT(hypergraph.isBorderNode(0), Eq(true));
@@ -888,6 +901,23 @@ TEST_F(AHypergraph, StoresCorrectFixedVertexPartWeights) {
   ASSERT_EQ(hypergraph.fixedVertexPartWeight(1), 1);
 }
 
+TEST_F(AHypergraph, CanRemoveAllFixedVertices) {
+  hypergraph.setFixedVertex(0, 0);
+  hypergraph.setFixedVertex(1, 0);
+  hypergraph.setFixedVertex(6, 1);
+
+  hypergraph.resetFixedVertices();
+  ASSERT_THAT(hypergraph.numFixedVertices(), Eq(0));
+  ASSERT_FALSE(hypergraph.isFixedVertex(0));
+  ASSERT_THAT(hypergraph.fixedVertexTotalWeight(), Eq(0));
+  ASSERT_THAT(hypergraph.fixedVertexPartWeight(0), Eq(0));
+  ASSERT_THAT(hypergraph.fixedVertexPartWeight(1), Eq(0));
+
+  hypergraph.setFixedVertex(1, 1);
+  ASSERT_THAT(hypergraph.numFixedVertices(), Eq(1));
+  ASSERT_THAT(hypergraph.fixedVertexPartWeight(1), Eq(1));
+}
+
 TEST_F(AHypergraph, UpdatesFixedVertexPartWeightsAfterContraction) {
   hypergraph.setFixedVertex(0, 0);
   hypergraph.setFixedVertex(1, 0);
@@ -1071,5 +1101,46 @@ TEST(Hypergraphs, CanBeStrippedOfAllIdenticalVertices) {
   ASSERT_EQ(hypergraph.edgeSize(0), 2);
   ASSERT_EQ(hypergraph.edgeSize(1), 2);
 }
+
+TEST(Hypergraphs, StorePinCountsSparselyForLargeK) {
+  Hypergraph hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+                        HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }, 256);
+  ASSERT_TRUE(hypergraph._pins_in_part.isSparse());
+  ASSERT_THAT(hypergraph._pins_in_part.size(), Eq(12));
+
+  const Memento memento = hypergraph.contract(5, 6);
+  hypergraph.setNodePart(0, 0);
+  hypergraph.setNodePart(1, 200);
+  hypergraph.setNodePart(2, 255);
+  hypergraph.setNodePart(3, 200);
+  hypergraph.setNodePart(4, 0);
+  hypergraph.setNodePart(5, 255);
+  hypergraph.initializeNumCutHyperedges();
+  ASSERT_THAT(hypergraph.pinCountInPart(3, 255), Eq(2));
+
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 0), Eq(2));
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 200), Eq(2));
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 255), Eq(0));
+  ASSERT_THAT(hypergraph.connectivity(1), Eq(2));
+
+  hypergraph.changeNodePart(1, 200, 0);
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 0), Eq(3));
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 200), Eq(1));
+
+  hypergraph.changeNodePart(3, 200, 0);
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 0), Eq(4));
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 200), Eq(0));
+  ASSERT_THAT(hypergraph.connectivity(1), Eq(1));
+
+  hypergraph.uncontract(memento);
+  ASSERT_THAT(hypergraph.pinCountInPart(2, 255), Eq(1));
+  ASSERT_THAT(hypergraph.pinCountInPart(3, 255), Eq(3));
+
+  hypergraph.removeEdge(1);
+  ASSERT_THAT(hypergraph._pins_in_part.get(1, 0), Eq(hypergraph.kInvalidCount));
+  hypergraph.restoreEdge(1);
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 0), Eq(4));
+  ASSERT_THAT(hypergraph.connectivity(1), Eq(1));
+}
 }  // namespace ds
 }  // namespace kahypar
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/incident_net_array.h"
+#include "kahypar/definitions.h"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AnIncidentNetArray : public Test {
+ public:
+  AnIncidentNetArray() :
+    incident_nets() {
+    incident_nets.initialize({ 2, 0, 4 });
+    incident_nets.push_back(0, 10);
+    incident_nets.push_back(0, 11);
+    incident_nets.push_back(2, 20);
+    incident_nets.push_back(2, 21);
+    incident_nets.push_back(2, 22);
+    incident_nets.push_back(2, 23);
+  }
+
+  std::vector<HyperedgeID> netsOf(const HypernodeID u) const {
+    return std::vector<HyperedgeID>(incident_nets.begin(u), incident_nets.end(u));
+  }
+
+  IncidentNetArray<HypernodeID, HyperedgeID> incident_nets;
+};
+
+TEST_F(AnIncidentNetArray, ReservesSlackForEachHypernode) {
+  ASSERT_THAT(incident_nets.capacity(0), Eq(4));
+  ASSERT_THAT(incident_nets.capacity(1), Eq(2));
+  ASSERT_THAT(incident_nets.capacity(2), Eq(6));
+  ASSERT_THAT(incident_nets.numEntries(), Eq(12));
+}
+
+TEST_F(AnIncidentNetArray, StoresIncidentNetsOfEachHypernode) {
+  ASSERT_THAT(netsOf(0), ElementsAre(10, 11));
+  ASSERT_THAT(netsOf(1), ElementsAre());
+  ASSERT_THAT(netsOf(2), ElementsAre(20, 21, 22, 23));
+}
+
+TEST_F(AnIncidentNetArray, AppendsNetsInPlaceIfSlackIsAvailable) {
+  incident_nets.push_back(0, 12);
+  incident_nets.push_back(0, 13);
+  ASSERT_THAT(netsOf(0), ElementsAre(10, 11, 12, 13));
+  ASSERT_THAT(netsOf(1), ElementsAre());
+  ASSERT_THAT(incident_nets.numEntries(), Eq(12));
+}
+
+TEST_F(AnIncidentNetArray, MovesRegionToTheEndIfSlackIsExhausted) {
+  incident_nets.push_back(0, 12);
+  incident_nets.push_back(0, 13);
+  incident_nets.push_back(0, 14);
+  ASSERT_THAT(netsOf(0), ElementsAre(10, 11, 12, 13, 14));
+  ASSERT_THAT(netsOf(2), ElementsAre(20, 21, 22, 23));
+  ASSERT_THAT(incident_nets.capacity(0), Eq(8));
+  ASSERT_THAT(incident_nets.numEntries(), Eq(20));
+}
+
+TEST_F(AnIncidentNetArray, GrowsLastRegionInPlace) {
+  incident_nets.push_back(2, 24);
+  incident_nets.push_back(2, 25);
+  incident_nets.push_back(2, 26);
+  ASSERT_THAT(netsOf(2), ElementsAre(20, 21, 22, 23, 24, 25, 26));
+  ASSERT_THAT(incident_nets.capacity(2), Eq(12));
+  ASSERT_THAT(incident_nets.numEntries(), Eq(18));
+}
+
+TEST_F(AnIncidentNetArray, CompactsRegionsIfMostEntriesAreAbandoned) {
+  for (HyperedgeID he = 12; he < 15; ++he) {
+    incident_nets.push_back(0, he);
+    incident_nets.push_back(1, he + 20);
+    incident_nets.push_back(2, he + 12);
+  }
+  ASSERT_THAT(incident_nets.numEntries(), Eq(36));
+  for (HyperedgeID he = 15; he < 19; ++he) {
+    incident_nets.push_back(0, he);
+  }
+  ASSERT_THAT(netsOf(0), ElementsAre(10, 11, 12, 13, 14, 15, 16, 17, 18));
+  ASSERT_THAT(netsOf(1), ElementsAre(32, 33, 34));
+  ASSERT_THAT(netsOf(2), ElementsAre(20, 21, 22, 23, 24, 25, 26));
+  ASSERT_THAT(incident_nets.capacity(0), Eq(16));
+  ASSERT_THAT(incident_nets.numEntries(), Eq(32));
+}
+
+TEST_F(AnIncidentNetArray, RemovesNetsBySwappingWithLastEntry) {
+  incident_nets.remove(2, 21);
+  ASSERT_THAT(netsOf(2), ElementsAre(20, 23, 22));
+  incident_nets.removeAt(2, 0);
+  ASSERT_THAT(netsOf(2), ElementsAre(22, 23));
+}
+
+TEST_F(AnIncidentNetArray, RestoresRemovedNetsInReverseOrder) {
+  incident_nets.remove(2, 21);
+  incident_nets.remove(2, 20);
+  incident_nets.push_back(2, 20);
+  incident_nets.push_back(2, 21);
+  ASSERT_THAT(netsOf(2), ElementsAre(22, 23, 20, 21));
+  ASSERT_THAT(incident_nets.numEntries(), Eq(12));
+}
+}  // namespace ds
+}  // namespace kahypar
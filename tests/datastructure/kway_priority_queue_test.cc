@@ -20,6 +20,7 @@
 
 #include "gmock/gmock.h"
 
+#include "kahypar/datastructure/bucket_queue.h"
 #include "kahypar/datastructure/kway_priority_queue.h"
 #include "kahypar/definitions.h"
 
@@ -261,5 +262,33 @@ TEST_F(AKWayPriorityQueue,
 
   ASSERT_THAT(prio_queue.numEnabledParts(), Eq(1));
 }
+
+TEST_F(AKWayPriorityQueue, ReplacesAllInternalHeapsIfInitializedAgain) {
+  prio_queue.insert(1, 2, 25);
+  prio_queue.enablePart(2);
+
+  prio_queue.initialize(100);
+
+  ASSERT_THAT(prio_queue.empty(), Eq(true));
+  ASSERT_THAT(prio_queue.numNonEmptyParts(), Eq(0));
+  prio_queue.insert(1, 3, 23);
+  prio_queue.enablePart(3);
+  ASSERT_THAT(prio_queue.max(), Eq(1));
+}
+
+TEST(ABucketQueueWithHeapFallback, FallsBackToAHeapIfTheGainRangeIsTooLarge) {
+  BucketQueueWithHeapFallback<HypernodeID, HyperedgeWeight> bucket_queue(10, 4, 4);
+  BucketQueueWithHeapFallback<HypernodeID, HyperedgeWeight> heap(10, 5, 4);
+  ASSERT_THAT(bucket_queue.usesBuckets(), Eq(true));
+  ASSERT_THAT(heap.usesBuckets(), Eq(false));
+
+  for (auto* queue : { &bucket_queue, &heap }) {
+    queue->push(3, -2);
+    queue->push(7, 1);
+    queue->updateKeyBy(3, 5);
+    ASSERT_THAT(queue->top(), Eq(3));
+    ASSERT_THAT(queue->topKey(), Eq(3));
+  }
+}
 }  // namespace ds
 }  // namespace kahypar
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <type_traits>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/pin_count_in_part.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+namespace kahypar {
+namespace ds {
+using PinCounts = PinCountInPart<HypernodeID, HyperedgeID, PartitionID>;
+
+class APinCountInPart : public TestWithParam<PartitionID> {
+ public:
+  APinCountInPart() :
+    k(GetParam()),
+    pin_counts() {
+    // three hyperedges with at most 2, 3 and 4 pins
+    pin_counts.initialize(3, k, [](const HyperedgeID he) {
+        return he + 2;
+      });
+  }
+
+  const PartitionID k;
+  PinCounts pin_counts;
+};
+
+INSTANTIATE_TEST_CASE_P(DenseAndSparse, APinCountInPart,
+                        Values(4, PinCounts::kMaxDenseK + 1));
+
+TEST_P(APinCountInPart, IsInitializedWithZeroPinCounts) {
+  ASSERT_THAT(pin_counts.isSparse(), Eq(k > PinCounts::kMaxDenseK));
+  for (HyperedgeID he = 0; he < 3; ++he) {
+    for (PartitionID part = 0; part < k; ++part) {
+      ASSERT_THAT(pin_counts.get(he, part), Eq(0));
+    }
+  }
+}
+
+TEST_P(APinCountInPart, CountsPinsOfEachBlock) {
+  ASSERT_THAT(pin_counts.increment(2, 0), Eq(1));
+  ASSERT_THAT(pin_counts.increment(2, k - 1), Eq(1));
+  ASSERT_THAT(pin_counts.increment(2, 0), Eq(2));
+  ASSERT_THAT(pin_counts.increment(2, 2), Eq(1));
+  ASSERT_THAT(pin_counts.get(2, 0), Eq(2));
+  ASSERT_THAT(pin_counts.get(2, 2), Eq(1));
+  ASSERT_THAT(pin_counts.get(2, k - 1), Eq(1));
+  ASSERT_THAT(pin_counts.get(1, 0), Eq(0));
+}
+
+TEST_P(APinCountInPart, RemovesBlocksWithoutPins) {
+  pin_counts.increment(1, 0);
+  pin_counts.increment(1, 1);
+  pin_counts.increment(1, 2);
+  ASSERT_THAT(pin_counts.decrement(1, 0), Eq(0));
+  ASSERT_THAT(pin_counts.get(1, 0), Eq(0));
+  ASSERT_THAT(pin_counts.get(1, 1), Eq(1));
+  ASSERT_THAT(pin_counts.get(1, 2), Eq(1));
+  ASSERT_THAT(pin_counts.increment(1, 3), Eq(1));
+  ASSERT_THAT(pin_counts.get(1, 3), Eq(1));
+}
+
+TEST_P(APinCountInPart, InvalidatesAndResetsPinCountsOfAHyperedge) {
+  pin_counts.increment(0, 1);
+  pin_counts.increment(1, 1);
+  pin_counts.invalidate(0);
+  ASSERT_THAT(pin_counts.get(0, 1), Eq(PinCounts::kInvalidCount));
+  ASSERT_THAT(pin_counts.get(1, 1), Eq(1));
+  pin_counts.reset(0);
+  ASSERT_THAT(pin_counts.get(0, 1), Eq(0));
+}
+
+TEST_P(APinCountInPart, IsEqualToPinCountsWithTheSameCountsInDifferentOrder) {
+  PinCounts other;
+  other.initialize(3, k, [](const HyperedgeID he) {
+      return he + 2;
+    });
+  pin_counts.increment(2, 0);
+  pin_counts.increment(2, 1);
+  other.increment(2, 1);
+  other.increment(2, 0);
+  ASSERT_TRUE(pin_counts == other);
+  other.increment(2, 0);
+  ASSERT_FALSE(pin_counts == other);
+}
+TEST(PinCountsInPart, UseTheNarrowestEntriesThatFitTheEdgeSizes) {
+  PinCounts pin_counts;
+  pin_counts.initialize(100, 4, [](const HyperedgeID) {
+      return 253;
+    });
+  ASSERT_THAT(pin_counts.bitsPerEntry(), Eq(8));
+  ASSERT_THAT(pin_counts.numWideEdges(), Eq(0));
+
+  pin_counts.initialize(100, 4, [](const HyperedgeID he) {
+      return he < 2 ? 254 : 2;
+    });
+  ASSERT_THAT(pin_counts.bitsPerEntry(), Eq(16));
+  ASSERT_THAT(pin_counts.numWideEdges(), Eq(0));
+
+  pin_counts.initialize(100, 4, [](const HyperedgeID he) {
+      return he < 2 ? 70000 : 2;
+    });
+  ASSERT_THAT(pin_counts.bitsPerEntry(), Eq(8 * sizeof(HypernodeID)));
+  ASSERT_THAT(pin_counts.numWideEdges(), Eq(0));
+  ASSERT_THAT(pin_counts.size(), Eq(400));
+}
+
+TEST(PinCountsInPart, StoreCountsOfHugeHyperedgesInFullWidthEntries) {
+  PinCounts pin_counts;
+  pin_counts.initialize(100, 4, [](const HyperedgeID he) {
+      return he == 42 ? 1000 : 10;
+    });
+  ASSERT_THAT(pin_counts.bitsPerEntry(), Eq(8));
+  ASSERT_THAT(pin_counts.numWideEdges(), Eq(1));
+
+  for (HypernodeID i = 0; i < 1000; ++i) {
+    pin_counts.increment(42, 3);
+  }
+  pin_counts.increment(41, 3);
+  pin_counts.increment(43, 3);
+  ASSERT_THAT(pin_counts.get(42, 3), Eq(1000));
+  ASSERT_THAT(pin_counts.get(42, 0), Eq(0));
+  ASSERT_THAT(pin_counts.decrement(42, 3), Eq(999));
+  ASSERT_THAT(pin_counts.get(41, 3), Eq(1));
+  ASSERT_THAT(pin_counts.get(43, 3), Eq(1));
+
+  pin_counts.invalidate(42);
+  ASSERT_THAT(pin_counts.get(42, 3), Eq(PinCounts::kInvalidCount));
+  pin_counts.reset(42);
+  ASSERT_THAT(pin_counts.get(42, 3), Eq(0));
+  pin_counts.increment(42, 1);
+  pin_counts.reset();
+  ASSERT_THAT(pin_counts.get(42, 1), Eq(0));
+  ASSERT_THAT(pin_counts.get(41, 3), Eq(0));
+  ASSERT_THAT(pin_counts.increment(42, 1), Eq(1));
+}
+
+TEST(PinCountsInPart, PassTheLayoutInUseToVisitors) {
+  PinCounts pin_counts;
+  pin_counts.initialize(100, 4, [](const HyperedgeID) {
+      return 300;
+    });
+  const bool is_dense16 = pin_counts.visit([](const auto& layout) {
+      return std::is_same<std::decay_t<decltype(layout)>, PinCounts::Dense16>::value;
+    });
+  ASSERT_TRUE(is_dense16);
+
+  pin_counts.visit([](auto& layout) {
+      layout.increment(7, 2);
+      layout.increment(7, 2);
+    });
+  ASSERT_THAT(pin_counts.get(7, 2), Eq(2));
+}
+}  // namespace ds
+}  // namespace kahypar
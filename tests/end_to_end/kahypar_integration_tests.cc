@@ -18,6 +18,12 @@
  *
  ******************************************************************************/
 
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/definitions.h"
@@ -138,6 +144,33 @@ TEST_F(KaHyParR, ComputesRecursiveBisectionKm1Partitioning) {
   ASSERT_EQ(metrics::km1(hypergraph), metrics::km1(verification_hypergraph));
 }
 
+TEST_F(KaHyParR, ComputesTaskParallelRecursiveBisectionIndependentOfNumberOfThreads) {
+  parseIniToContext(context, "../../../config/old_reference_configs/cut_rb_alenex16.ini");
+  context.partition.k = 8;
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  context.shared_memory.parallel_recursive_bisection = true;
+
+  Hypergraph sequential_hypergraph(
+    kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
+                                          context.partition.k));
+  context.shared_memory.num_threads = 1;
+  PartitionerFacade().partition(sequential_hypergraph, context);
+
+  Hypergraph parallel_hypergraph(
+    kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
+                                          context.partition.k));
+  context.shared_memory.num_threads = 4;
+  PartitionerFacade().partition(parallel_hypergraph, context);
+
+  ASSERT_LE(metrics::imbalance(parallel_hypergraph, context), context.partition.epsilon);
+  for (const HypernodeID& hn : parallel_hypergraph.nodes()) {
+    ASSERT_EQ(parallel_hypergraph.partID(hn), sequential_hypergraph.partID(hn));
+  }
+  ASSERT_EQ(metrics::km1(parallel_hypergraph), metrics::km1(sequential_hypergraph));
+}
+
 TEST_F(KaHyParCA, ComputesDirectKwayKm1Partitioning) {
   parseIniToContext(context, "../../../config/old_reference_configs/km1_direct_kway_sea17.ini");
   context.partition.k = 8;
@@ -236,6 +269,38 @@ TEST_F(KaHyParE, ComputesDirectKwayKm1Partitioning) {
   ASSERT_EQ(metrics::km1(hypergraph), metrics::km1(verification_hypergraph));
 }
 
+TEST_F(KaHyParE, ComputesDirectKwayKm1PartitioningWithIslandModel) {
+  parseIniToContext(context, "configs/test.ini");
+  context.partition.k = 3;
+  context.partition.quiet_mode = true;
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.partition.mode = Mode::direct_kway;
+  context.local_search.algorithm = RefinementAlgorithm::kway_fm_km1;
+  context.evolutionary.replace_strategy = EvoReplaceStrategy::diverse;
+  context.evolutionary.migration_interval = 1;
+  context.shared_memory.num_threads = 4;
+  context.partition_evolutionary = true;
+  context.partition.graph_filename = "../../../tests/partition/evolutionary/TestHypergraph";
+  Hypergraph hypergraph(
+    kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
+                                          context.partition.k));
+
+  PartitionerFacade().partition(hypergraph, context);
+
+  Hypergraph verification_hypergraph(
+    kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
+                                          context.partition.k));
+
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    verification_hypergraph.setNodePart(hn, hypergraph.partID(hn));
+  }
+
+  ASSERT_EQ(metrics::hyperedgeCut(hypergraph), metrics::hyperedgeCut(verification_hypergraph));
+  ASSERT_EQ(metrics::soed(hypergraph), metrics::soed(verification_hypergraph));
+  ASSERT_EQ(metrics::km1(hypergraph), metrics::km1(verification_hypergraph));
+}
+
 TEST(KaHyPar, SupportsIndividualBlockWeightsViaInterface) {
   kahypar_context_t* context = kahypar_context_new();
   kahypar_configure_context_from_file(context, "../../../config/old_reference_configs/km1_direct_kway_sea18.ini");
@@ -298,4 +363,204 @@ TEST(KaHyPar, SupportsIndividualBlockWeightsViaInterface) {
 
   kahypar_context_free(context);
 }
+
+TEST(KaHyPar, PartitionsHypergraphHandleMultipleTimesViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/old_reference_configs/km1_direct_kway_sea18.ini");
+
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+
+  size_t* index_ptr = nullptr;
+  kahypar_hypernode_id_t* hyperedges_ptr = nullptr;
+
+  kahypar_hyperedge_weight_t* hyperedge_weights_ptr = nullptr;
+  kahypar_hypernode_weight_t* vertex_weights_ptr = nullptr;
+
+  const std::string filename("test_instances/ISPD98_ibm01.hgr");
+  kahypar_read_hypergraph_from_file(filename.c_str(),
+                                    &num_hypernodes,
+                                    &num_hyperedges,
+                                    &index_ptr,
+                                    &hyperedges_ptr,
+                                    &hyperedge_weights_ptr,
+                                    &vertex_weights_ptr);
+
+  const double imbalance = 0.03;
+  kahypar_hypergraph_t* hypergraph = kahypar_create_hypergraph(2,
+                                                               num_hypernodes,
+                                                               num_hyperedges,
+                                                               index_ptr,
+                                                               hyperedges_ptr,
+                                                               hyperedge_weights_ptr,
+                                                               vertex_weights_ptr);
+
+  for (const kahypar_partition_id_t num_blocks : { 4, 8, 4 }) {
+    kahypar_hyperedge_weight_t objective = 0;
+    std::vector<kahypar_partition_id_t> partition(num_hypernodes, -1);
+    kahypar_partition_hypergraph(hypergraph, num_blocks, imbalance, &objective,
+                                 context, partition.data());
+
+    // Contraction and uncontraction permute the pins and incident nets of the reused
+    // hypergraph, so later calls may compute different partitions than a fresh one.
+    Hypergraph verification_hypergraph(io::createHypergraphFromFile(filename, num_blocks));
+    for (const HypernodeID& hn : verification_hypergraph.nodes()) {
+      ASSERT_LT(partition[hn], num_blocks);
+      verification_hypergraph.setNodePart(hn, partition[hn]);
+    }
+    ASSERT_EQ(objective, metrics::km1(verification_hypergraph));
+  }
+
+  kahypar_hypergraph_free(hypergraph);
+  delete[] index_ptr;
+  delete[] hyperedges_ptr;
+  delete[] hyperedge_weights_ptr;
+  delete[] vertex_weights_ptr;
+  kahypar_context_free(context);
+}
+
+TEST(KaHyPar, ReadsTheFixedVerticesOfEachCallOnAHypergraphHandleViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/old_reference_configs/km1_direct_kway_sea18.ini");
+
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+
+  size_t* index_ptr = nullptr;
+  kahypar_hypernode_id_t* hyperedges_ptr = nullptr;
+
+  kahypar_hyperedge_weight_t* hyperedge_weights_ptr = nullptr;
+  kahypar_hypernode_weight_t* vertex_weights_ptr = nullptr;
+
+  const std::string filename("test_instances/ISPD98_ibm01.hgr");
+  kahypar_read_hypergraph_from_file(filename.c_str(),
+                                    &num_hypernodes,
+                                    &num_hyperedges,
+                                    &index_ptr,
+                                    &hyperedges_ptr,
+                                    &hyperedge_weights_ptr,
+                                    &vertex_weights_ptr);
+
+  const double imbalance = 0.03;
+  kahypar_hypergraph_t* hypergraph = kahypar_create_hypergraph(8,
+                                                               num_hypernodes,
+                                                               num_hyperedges,
+                                                               index_ptr,
+                                                               hyperedges_ptr,
+                                                               hyperedge_weights_ptr,
+                                                               vertex_weights_ptr);
+
+  // The number of blocks shrinks between the calls, and each call fixes
+  // different hypernodes (or none at all).
+  const std::vector<std::pair<kahypar_partition_id_t, HypernodeID> > calls = { { 8, 0 },
+                                                                               { 4, 50 },
+                                                                               { 2, 100 } };
+  for (const auto& call : calls) {
+    const kahypar_partition_id_t num_blocks = call.first;
+    std::vector<PartitionID> fixed_vertices(num_hypernodes, -1);
+    std::string fixed_vertex_filename;
+    if (call.second < 100) {
+      fixed_vertex_filename = "ReusedHypergraphHandle.fix";
+      std::ofstream out_stream(fixed_vertex_filename.c_str());
+      for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+        if (hn % 100 == call.second) {
+          fixed_vertices[hn] = (hn / 100) % num_blocks;
+        }
+        out_stream << fixed_vertices[hn] << std::endl;
+      }
+      out_stream.close();
+    }
+    kahypar_set_context_partition_fixed_vertex_filename(context, fixed_vertex_filename.c_str());
+
+    kahypar_hyperedge_weight_t objective = 0;
+    std::vector<kahypar_partition_id_t> partition(num_hypernodes, -1);
+    kahypar_partition_hypergraph(hypergraph, num_blocks, imbalance, &objective,
+                                 context, partition.data());
+
+    Hypergraph verification_hypergraph(io::createHypergraphFromFile(filename, num_blocks));
+    for (const HypernodeID& hn : verification_hypergraph.nodes()) {
+      ASSERT_LT(partition[hn], num_blocks);
+      verification_hypergraph.setNodePart(hn, partition[hn]);
+    }
+    ASSERT_EQ(objective, metrics::km1(verification_hypergraph));
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      ASSERT_TRUE(fixed_vertices[hn] == -1 ||
+                  static_cast<PartitionID>(partition[hn]) == fixed_vertices[hn]);
+    }
+  }
+
+  kahypar_hypergraph_free(hypergraph);
+  delete[] index_ptr;
+  delete[] hyperedges_ptr;
+  delete[] hyperedge_weights_ptr;
+  delete[] vertex_weights_ptr;
+  kahypar_context_free(context);
+}
+
+TEST(KaHyPar, SupportsConcurrentCallsWithTheSameContextViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/old_reference_configs/km1_direct_kway_sea18.ini");
+
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+
+  size_t* index_ptr = nullptr;
+  kahypar_hypernode_id_t* hyperedges_ptr = nullptr;
+
+  kahypar_hyperedge_weight_t* hyperedge_weights_ptr = nullptr;
+  kahypar_hypernode_weight_t* vertex_weights_ptr = nullptr;
+
+  const std::string filename("test_instances/ISPD98_ibm01.hgr");
+  kahypar_read_hypergraph_from_file(filename.c_str(),
+                                    &num_hypernodes,
+                                    &num_hyperedges,
+                                    &index_ptr,
+                                    &hyperedges_ptr,
+                                    &hyperedge_weights_ptr,
+                                    &vertex_weights_ptr);
+
+  const double imbalance = 0.03;
+  const std::vector<kahypar_partition_id_t> num_blocks = { 2, 4, 8, 16 };
+  std::vector<kahypar_hyperedge_weight_t> objectives(num_blocks.size(), 0);
+  std::vector<std::vector<kahypar_partition_id_t> > partitions(
+    num_blocks.size(), std::vector<kahypar_partition_id_t>(num_hypernodes, -1));
+
+  auto partition = [&](const size_t i, kahypar_hyperedge_weight_t* objective,
+                       kahypar_partition_id_t* result) {
+                     kahypar_partition(num_hypernodes,
+                                       num_hyperedges,
+                                       imbalance,
+                                       num_blocks[i],
+                                       vertex_weights_ptr,
+                                       hyperedge_weights_ptr,
+                                       index_ptr,
+                                       hyperedges_ptr,
+                                       objective,
+                                       context,
+                                       result);
+                   };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_blocks.size(); ++i) {
+    threads.emplace_back(partition, i, &objectives[i], partitions[i].data());
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Each concurrent call has to compute the same result as a sequential call.
+  for (size_t i = 0; i < num_blocks.size(); ++i) {
+    kahypar_hyperedge_weight_t expected_objective = 0;
+    std::vector<kahypar_partition_id_t> expected_partition(num_hypernodes, -1);
+    partition(i, &expected_objective, expected_partition.data());
+    ASSERT_EQ(objectives[i], expected_objective);
+    ASSERT_EQ(partitions[i], expected_partition);
+  }
+
+  delete[] index_ptr;
+  delete[] hyperedges_ptr;
+  delete[] hyperedge_weights_ptr;
+  delete[] vertex_weights_ptr;
+  kahypar_context_free(context);
+}
 }  // namespace kahypar
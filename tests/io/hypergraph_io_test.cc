@@ -18,6 +18,9 @@
  *
  ******************************************************************************/
 
+#include <fstream>
+#include <string>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/io/hypergraph_io.h"
@@ -122,6 +125,78 @@ TEST_F(AHypergraphFileWithoutHyperedges, CanBeParsedIntoAHypergraphIfFileContain
   }
 }
 
+TEST_F(AnUnweightedHypergraphFile, CanBeParsedUsingMemoryMapping) {
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+
+  readHypergraphFileMapped(_filename, _num_hypernodes, _num_hyperedges, index_vector, edge_vector);
+
+  ASSERT_THAT(_num_hypernodes, Eq(_control_num_hypernodes));
+  ASSERT_THAT(_num_hyperedges, Eq(_control_num_hyperedges));
+  ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+  ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+}
+
+TEST_F(AnUnweightedHypergraphFile, SkipsBlankLinesWhenParsedUsingMemoryMapping) {
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+
+  readHypergraphFileMapped("test_instances/unweighted_hypergraph_with_blank_lines.hgr",
+                           _num_hypernodes, _num_hyperedges, index_vector, edge_vector);
+
+  ASSERT_THAT(_num_hypernodes, Eq(_control_num_hypernodes));
+  ASSERT_THAT(_num_hyperedges, Eq(_control_num_hyperedges));
+  ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+  ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+}
+
+TEST_F(AHypergraphFileWithHypernodeAndHyperedgeWeights, CanBeParsedUsingMemoryMapping) {
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HypernodeWeightVector hypernode_weights;
+  HyperedgeWeightVector hyperedge_weights;
+
+  readHypergraphFileMapped(_filename, _num_hypernodes, _num_hyperedges, index_vector, edge_vector,
+                           &hyperedge_weights, &hypernode_weights);
+
+  ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+  ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+  ASSERT_THAT(hyperedge_weights, ContainerEq(_control_hyperedge_weights));
+  ASSERT_THAT(hypernode_weights, ContainerEq(_control_hypernode_weights));
+}
+
+TEST_F(AHypergraphFileWithHypernodeAndHyperedgeWeights, CanBeParsedConcurrentlyInSeveralChunks) {
+  const HypergraphFileParser parser(_filename, 4, /*min chunk size*/ 1);
+  ASSERT_THAT(parser.numPins(), Eq(_control_edge_vector.size()));
+
+  HyperedgeIndexVector index_vector(parser.numHyperedges() + 1);
+  HyperedgeVector edge_vector(parser.numPins());
+  HyperedgeWeightVector hyperedge_weights(parser.numHyperedges());
+  HypernodeWeightVector hypernode_weights(parser.numHypernodes());
+  parser.parse(index_vector.data(), edge_vector.data(),
+               hyperedge_weights.data(), hypernode_weights.data());
+
+  ASSERT_THAT(index_vector, ContainerEq(_control_index_vector));
+  ASSERT_THAT(edge_vector, ContainerEq(_control_edge_vector));
+  ASSERT_THAT(hyperedge_weights, ContainerEq(_control_hyperedge_weights));
+  ASSERT_THAT(hypernode_weights, ContainerEq(_control_hypernode_weights));
+}
+
+TEST_F(AHypergraphFileWithoutHyperedges, CanBeParsedUsingMemoryMapping) {
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HypernodeWeightVector hypernode_weights;
+  HyperedgeWeightVector hyperedge_weights;
+  readHypergraphFileMapped(_filename, _num_hypernodes, _num_hyperedges, index_vector, edge_vector,
+                           &hyperedge_weights, &hypernode_weights);
+  ASSERT_THAT(index_vector.size(), Eq(1));
+  ASSERT_THAT(edge_vector.empty(), Eq(true));
+  ASSERT_THAT(_num_hypernodes, Eq(3));
+  ASSERT_THAT(_num_hyperedges, Eq(0));
+  ASSERT_THAT(hypernode_weights, ContainerEq(_control_hypernode_weights));
+  ASSERT_THAT(hyperedge_weights.empty(), Eq(true));
+}
+
 TEST(AHypergraphWithoutHyperedges, CanBeWrittenToFile) {
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_hyperedges = 0;
@@ -197,6 +272,61 @@ TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToFile) {
   ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
 }
 
+TEST_F(AnUnweightedHypergraph, CanBeWrittenToBinaryFile) {
+  writeHypergraphBinaryFile(*_hypergraph, _filename);
+
+  ASSERT_THAT(isBinaryHypergraphFile(_filename), Eq(true));
+  Hypergraph hypergraph2 = createHypergraphFromBinaryFile(_filename, 2);
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AHypergraphWithHyperedgeWeights, CanBeWrittenToBinaryFile) {
+  writeHypergraphBinaryFile(*_hypergraph, _filename);
+
+  Hypergraph hypergraph2 = createHypergraphFromBinaryFile(_filename, 2);
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AHypergraphWithHypernodeWeights, CanBeWrittenToBinaryFile) {
+  writeHypergraphBinaryFile(*_hypergraph, _filename);
+
+  Hypergraph hypergraph2 = createHypergraphFromBinaryFile(_filename, 2);
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToBinaryFile) {
+  writeHypergraphBinaryFile(*_hypergraph, _filename);
+
+  const BinaryHypergraphFile file(_filename);
+  ASSERT_THAT(reinterpret_cast<uintptr_t>(file.edgeVector()) % kBinaryHypergraphAlignment, Eq(0));
+  ASSERT_THAT(reinterpret_cast<uintptr_t>(file.hyperedgeWeights()) % kBinaryHypergraphAlignment,
+              Eq(0));
+  ASSERT_THAT(reinterpret_cast<uintptr_t>(file.hypernodeWeights()) % kBinaryHypergraphAlignment,
+              Eq(0));
+  ASSERT_THAT(HyperedgeWeightVector(file.hyperedgeWeights(),
+                                    file.hyperedgeWeights() + file.numHyperedges()),
+              ContainerEq(_hyperedge_weights));
+  ASSERT_THAT(HypernodeWeightVector(file.hypernodeWeights(),
+                                    file.hypernodeWeights() + file.numHypernodes()),
+              ContainerEq(_hypernode_weights));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, IsLoadedFromBinaryFileByCreateHypergraphFromFile) {
+  writeHypergraphBinaryFile(*_hypergraph, _filename);
+
+  Hypergraph hypergraph2 = createHypergraphFromFile(_filename, 2);
+
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AnUnweightedHypergraph, ReportsIfTheBinaryFileCannotBeWritten) {
+  ASSERT_THAT(writeHypergraphBinaryFile(*_hypergraph, "nonexistent_directory/hypergraph.bin"),
+              Eq(false));
+}
+
 TEST_F(APartitionOfAHypergraph, IsCorrectlyWrittenToFile) {
   multilevel::partition(_hypergraph, *_coarsener, *_refiner, _context);
   writePartitionFile(_hypergraph, _context.partition.graph_partition_filename);
@@ -243,10 +373,55 @@ TEST(AHypergraph, CanBeSerializedToPaToHFormat) {
   ASSERT_THAT(serialized_lines, ::testing::ContainerEq(original_lines));
 }
 
+template <typename T>
+static void overwriteBinaryFile(const std::string& filename, const size_t offset, const T value) {
+  std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(offset);
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+TEST(AHypergraphDeathTest, WithNonMonotoneHyperedgeIndicesInBinaryFileLeadsToProgramExit) {
+  const std::string filename = "test_instances/corrupted_binary_hypergraph.bin";
+  Hypergraph hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9, 12 },
+                        HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+  ASSERT_THAT(writeHypergraphBinaryFile(hypergraph, filename), Eq(true));
+  // index_vector[1] = 7 > index_vector[2] = 6
+  overwriteBinaryFile<size_t>(filename, sizeof(BinaryHypergraphHeader) + sizeof(size_t), 7);
+
+  EXPECT_EXIT(createHypergraphFromFile(filename, 2), ::testing::ExitedWithCode(1),
+              "contains non-monotone hyperedge indices");
+}
+
+TEST(AHypergraphDeathTest, WithInvalidPinInBinaryFileLeadsToProgramExit) {
+  const std::string filename = "test_instances/corrupted_binary_hypergraph.bin";
+  Hypergraph hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9, 12 },
+                        HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+  ASSERT_THAT(writeHypergraphBinaryFile(hypergraph, filename), Eq(true));
+  const size_t edge_vector_offset =
+    internal::alignedOffset(sizeof(BinaryHypergraphHeader) + 5 * sizeof(size_t));
+  overwriteBinaryFile<HypernodeID>(filename, edge_vector_offset, 7);
+
+  EXPECT_EXIT(createHypergraphFromFile(filename, 2), ::testing::ExitedWithCode(1),
+              "contains invalid hypernode ID 7");
+}
+
 TEST(AHypergraphDeathTest, WithEmptyHyperedgesLeadsToProgramExit) {
+  // Blank lines are skipped, i.e., the file contains fewer hyperedges than its header states.
   EXPECT_EXIT(createHypergraphFromFile("test_instances/corrupted_hypergraph_with_empty_hyperedges.hgr", 2),
               ::testing::ExitedWithCode(1),
-              "Error: Hyperedge 1 is empty");
+              "Error: File contains 3 of 6 hyperedges");
+}
+
+TEST(AHypergraphDeathTest, WithHypernodeIDZeroLeadsToProgramExit) {
+  EXPECT_EXIT(createHypergraphFromFile("test_instances/corrupted_hypergraph_with_pin_zero.hgr", 2),
+              ::testing::ExitedWithCode(1),
+              "Error: Hyperedge 1 contains invalid hypernode ID 0");
+}
+
+TEST(AHypergraphDeathTest, WithOutOfRangeHypernodeIDLeadsToProgramExit) {
+  EXPECT_EXIT(createHypergraphFromFile("test_instances/corrupted_hypergraph_with_invalid_pin.hgr", 2),
+              ::testing::ExitedWithCode(1),
+              "Error: Hyperedge 1 contains invalid hypernode ID 4");
 }
 }  // namespace io
 }  // namespace kahypar
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/ml_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+namespace kahypar {
+using CoarsenerType = MLCoarsener<HeavyEdgeScore,
+                                  MultiplicativePenalty,
+                                  UseCommunityStructure,
+                                  NormalPartitionPolicy,
+                                  BestRatingPreferringUnmatched<RandomRatingWins>,
+                                  AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                  RatingType>;
+
+class AnMLCoarsener : public ACoarsenerBase<CoarsenerType>{
+ public:
+  explicit AnMLCoarsener() :
+    ACoarsenerBase(createHypergraphWith200Hypernodes()) {
+    context.coarsening.max_allowed_node_weight = 10;
+    context.partition.perfect_balance_part_weights.assign(2, 100);
+    context.partition.max_part_weights.assign(2, (1 + context.partition.epsilon) * 100);
+  }
+};
+
+TEST_F(AnMLCoarsener, RestoresOriginalHypergraphDuringBatchUncoarsening) {
+  restoresOriginalHypergraphDuringBatchUncoarsening(coarsener, hypergraph, context, refiner);
+}
+
+TEST_F(AnMLCoarsener, RefinesBatchesOfPairwiseDistinctHypernodes) {
+  refinesBatchesOfPairwiseDistinctHypernodes(coarsener, hypergraph, context);
+}
+
+TEST_F(AnMLCoarsener, AlwaysUsesNLevelUncoarseningForTwoWayFM) {
+  alwaysUsesNLevelUncoarseningForTwoWayFM(coarsener, hypergraph, context);
+}
+}  // namespace kahypar
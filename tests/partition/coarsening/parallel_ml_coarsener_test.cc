@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/parallel_ml_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+namespace kahypar {
+using CoarsenerType = ParallelMLCoarsener<HeavyEdgeScore,
+                                          MultiplicativePenalty,
+                                          UseCommunityStructure,
+                                          NormalPartitionPolicy,
+                                          BestRatingPreferringUnmatched<RandomRatingWins>,
+                                          AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                          RatingType>;
+
+class AParallelMLCoarsener : public ACoarsenerBase<CoarsenerType>{
+ public:
+  explicit AParallelMLCoarsener() :
+    ACoarsenerBase(createHypergraphWith200Hypernodes()) {
+    context.shared_memory.num_threads = 4;
+    context.coarsening.max_allowed_node_weight = 10;
+    context.partition.perfect_balance_part_weights.assign(2, 100);
+    context.partition.max_part_weights.assign(2, (1 + context.partition.epsilon) * 100);
+  }
+};
+
+TEST_F(AParallelMLCoarsener, CoarsensHypergraphDownToContractionLimit) {
+  coarsener.coarsen(40);
+  ASSERT_THAT(hypergraph->currentNumNodes(), Le(40));
+}
+
+TEST_F(AParallelMLCoarsener, RespectsMaximumAllowedNodeWeight) {
+  coarsener.coarsen(2);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(hypergraph->nodeWeight(hn), Le(context.coarsening.max_allowed_node_weight));
+  }
+}
+
+TEST_F(AParallelMLCoarsener, RestoresOriginalHypergraphDuringUncoarsening) {
+  const Hypergraph original = ds::copyHypergraph(*hypergraph);
+  coarsener.coarsen(40);
+  partitionCoarsestHypergraphAlternately(hypergraph);
+  coarsener.uncoarsen(*refiner);
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(original, *hypergraph), Eq(true));
+}
+
+TEST_F(AParallelMLCoarsener, ComputesSameCoarseHypergraphForSameSeedAndNumberOfThreads) {
+  coarsener.coarsen(40);
+
+  std::unique_ptr<Hypergraph> other_hypergraph(createHypergraphWith200Hypernodes());
+  CoarsenerType other_coarsener(*other_hypergraph, context,  /* heaviest_node_weight */ 1);
+  Randomize::instance().setSeed(context.partition.seed);
+  other_coarsener.coarsen(40);
+
+  ASSERT_THAT(other_hypergraph->currentNumNodes(), Eq(hypergraph->currentNumNodes()));
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(other_hypergraph->nodeIsEnabled(hn), Eq(true));
+    ASSERT_THAT(other_hypergraph->nodeWeight(hn), Eq(hypergraph->nodeWeight(hn)));
+  }
+}
+
+TEST_F(AParallelMLCoarsener, RemovesAllParallelHyperedgesIfRemovalIsDeferredToEndOfPass) {
+  context.coarsening.remove_parallel_hes_per_pass = true;
+  coarsener.coarsen(40);
+
+  std::vector<std::vector<HypernodeID> > pin_sets;
+  for (const HyperedgeID& he : hypergraph->edges()) {
+    std::vector<HypernodeID> pins(hypergraph->pins(he).first, hypergraph->pins(he).second);
+    std::sort(pins.begin(), pins.end());
+    pin_sets.push_back(pins);
+  }
+  std::sort(pin_sets.begin(), pin_sets.end());
+  ASSERT_THAT(std::adjacent_find(pin_sets.begin(), pin_sets.end()) == pin_sets.end(), Eq(true));
+}
+
+TEST_F(AParallelMLCoarsener, RestoresParallelHyperedgesRemovedAtEndOfPass) {
+  context.coarsening.remove_parallel_hes_per_pass = true;
+  const Hypergraph original = ds::copyHypergraph(*hypergraph);
+  coarsener.coarsen(40);
+  partitionCoarsestHypergraphAlternately(hypergraph);
+  coarsener.uncoarsen(*refiner);
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(original, *hypergraph), Eq(true));
+}
+
+TEST_F(AParallelMLCoarsener, RestoresOriginalHypergraphDuringBatchUncoarsening) {
+  restoresOriginalHypergraphDuringBatchUncoarsening(coarsener, hypergraph, context, refiner);
+}
+
+TEST_F(AParallelMLCoarsener, RefinesBatchesOfPairwiseDistinctHypernodes) {
+  refinesBatchesOfPairwiseDistinctHypernodes(coarsener, hypergraph, context);
+}
+
+TEST_F(AParallelMLCoarsener, AlwaysUsesNLevelUncoarseningForTwoWayFM) {
+  alwaysUsesNLevelUncoarseningForTwoWayFM(coarsener, hypergraph, context);
+}
+
+TEST(AnUncoarseningOperation, RestoresParallelHyperedgesInReverseOrder) {
+  restoresParallelHyperedgesInReverseOrder<CoarsenerType>();
+}
+
+TEST(AnUncoarseningOperation, RestoresSingleNodeHyperedgesInReverseOrder) {
+  restoresSingleNodeHyperedgesInReverseOrder<CoarsenerType>();
+}
+}  // namespace kahypar
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -272,4 +274,101 @@ void doesNotCoarsenUntilCoarseningLimit(Coarsener& coarsener, HypergraphT& hyper
   }
   ASSERT_THAT(hypergraph->currentNumNodes(), Eq(3));
 }
+
+// Hypergraph with 200 hypernodes and 300 hyperedges of size 3.
+static inline Hypergraph* createHypergraphWith200Hypernodes() {
+  const HypernodeID num_hypernodes = 200;
+  const HyperedgeID num_hyperedges = 300;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    index_vector.push_back(edge_vector.size());
+    edge_vector.push_back(he % num_hypernodes);
+    edge_vector.push_back((he + 1 + he % 5) % num_hypernodes);
+    edge_vector.push_back((he + 7 + he % 11) % num_hypernodes);
+  }
+  index_vector.push_back(edge_vector.size());
+  return new Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+}
+
+// Records the refinement nodes of each refinement call.
+class RecordingRefiner final : public IRefiner {
+ public:
+  std::vector<std::vector<HypernodeID> > refinement_calls;
+
+ private:
+  bool refineImpl(std::vector<HypernodeID>& refinement_nodes,
+                  const std::array<HypernodeWeight, 2>&,
+                  const UncontractionGainChanges&,
+                  Metrics&) override final {
+    refinement_calls.push_back(refinement_nodes);
+    return false;
+  }
+};
+
+template <class HypergraphT>
+void partitionCoarsestHypergraphAlternately(HypergraphT& hypergraph) {
+  PartitionID part = 0;
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    hypergraph->setNodePart(hn, part);
+    part = 1 - part;
+  }
+  hypergraph->initializeNumCutHyperedges();
+}
+
+// The following tests expect a hypergraph created by createHypergraphWith200Hypernodes().
+template <class Coarsener, class HypergraphT, class Context, class Refiner>
+void restoresOriginalHypergraphDuringBatchUncoarsening(Coarsener& coarsener,
+                                                       HypergraphT& hypergraph,
+                                                       Context& context, Refiner& refiner) {
+  context.local_search.uncontraction_batch_size = 8;
+  const Hypergraph original = ds::copyHypergraph(*hypergraph);
+  coarsener.coarsen(40);
+  partitionCoarsestHypergraphAlternately(hypergraph);
+  coarsener.uncoarsen(*refiner);
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(original, *hypergraph), Eq(true));
+}
+
+template <class Coarsener, class HypergraphT, class Context>
+void refinesBatchesOfPairwiseDistinctHypernodes(Coarsener& coarsener, HypergraphT& hypergraph,
+                                                Context& context) {
+  context.local_search.uncontraction_batch_size = 8;
+  coarsener.coarsen(40);
+  const HypernodeID num_contractions = hypergraph->initialNumNodes() -
+                                       hypergraph->currentNumNodes();
+  partitionCoarsestHypergraphAlternately(hypergraph);
+  RecordingRefiner recording_refiner;
+  recording_refiner.initialize(0);
+  coarsener.uncoarsen(recording_refiner);
+
+  size_t num_refined_hns = 0;
+  size_t max_batch = 0;
+  for (std::vector<HypernodeID> refinement_nodes : recording_refiner.refinement_calls) {
+    ASSERT_THAT(refinement_nodes.size() % 2, Eq(0));
+    ASSERT_THAT(refinement_nodes.size(), Le(16));
+    std::sort(refinement_nodes.begin(), refinement_nodes.end());
+    ASSERT_THAT(std::adjacent_find(refinement_nodes.begin(), refinement_nodes.end()) ==
+                refinement_nodes.end(), Eq(true));
+    num_refined_hns += refinement_nodes.size();
+    max_batch = std::max(max_batch, refinement_nodes.size());
+  }
+  ASSERT_THAT(num_refined_hns, Eq(2 * num_contractions));
+  ASSERT_THAT(max_batch, Eq(16));
+}
+
+template <class Coarsener, class HypergraphT, class Context>
+void alwaysUsesNLevelUncoarseningForTwoWayFM(Coarsener& coarsener, HypergraphT& hypergraph,
+                                             Context& context) {
+  context.local_search.uncontraction_batch_size = 8;
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  coarsener.coarsen(40);
+  partitionCoarsestHypergraphAlternately(hypergraph);
+  RecordingRefiner recording_refiner;
+  recording_refiner.initialize(0);
+  coarsener.uncoarsen(recording_refiner);
+
+  for (const std::vector<HypernodeID>& refinement_nodes : recording_refiner.refinement_calls) {
+    ASSERT_THAT(refinement_nodes.size(), Eq(2));
+  }
+}
 }  // namespace kahypar
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/kahypar.h"
+#include "kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
+#include "kahypar/partition/metrics.h"
+
+using ::testing::AllOf;
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Le;
+using ::testing::Lt;
+using ::testing::Test;
+
+namespace kahypar {
+class APoolInitialPartitioner : public Test {
+ public:
+  APoolInitialPartitioner() :
+    hypergraph(createHypergraph()),
+    context() {
+    context.partition.k = k;
+    context.partition.epsilon = 0.05;
+    context.partition.objective = Objective::km1;
+    context.initial_partitioning.k = k;
+    context.initial_partitioning.unassigned_part = 1;
+    context.initial_partitioning.refinement = false;
+    context.initial_partitioning.nruns = 3;
+    context.initial_partitioning.upper_allowed_partition_weight.resize(k);
+    context.initial_partitioning.perfect_balance_partition_weight.resize(k);
+    context.partition.max_part_weights.resize(k);
+    context.partition.perfect_balance_part_weights.resize(k);
+    for (PartitionID i = 0; i < k; ++i) {
+      context.initial_partitioning.perfect_balance_partition_weight[i] =
+        ceil(hypergraph->totalWeight() / static_cast<double>(k));
+      context.initial_partitioning.upper_allowed_partition_weight[i] =
+        context.initial_partitioning.perfect_balance_partition_weight[i]
+        * (1.0 + context.partition.epsilon);
+      context.partition.perfect_balance_part_weights[i] =
+        context.initial_partitioning.perfect_balance_partition_weight[i];
+      context.partition.max_part_weights[i] =
+        context.initial_partitioning.upper_allowed_partition_weight[i];
+    }
+    context.shared_memory.parallel_initial_partitioning_pool = true;
+    Randomize::instance().setSeed(context.partition.seed);
+  }
+
+  static std::unique_ptr<Hypergraph> createHypergraph() {
+    return std::unique_ptr<Hypergraph>(new Hypergraph(
+                                         io::createHypergraphFromFile(
+                                           "test_instances/test_instance.hgr", k)));
+  }
+
+  std::vector<PartitionID> partitionWithThreads(Hypergraph& hg, const size_t num_threads) {
+    Context pool_context(context);
+    pool_context.shared_memory.num_threads = num_threads;
+    Randomize::instance().setSeed(context.partition.seed);
+    PoolInitialPartitioner(hg, pool_context).partition();
+    std::vector<PartitionID> partition;
+    for (const HypernodeID& hn : hg.nodes()) {
+      partition.push_back(hg.partID(hn));
+    }
+    return partition;
+  }
+
+  static constexpr PartitionID k = 4;
+  std::unique_ptr<Hypergraph> hypergraph;
+  Context context;
+};
+
+TEST_F(APoolInitialPartitioner, ComputesAFeasiblePartitionInParallelMode) {
+  partitionWithThreads(*hypergraph, 4);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(hypergraph->partID(hn), AllOf(Ge(0), Lt(k)));
+  }
+  ASSERT_THAT(metrics::imbalance(*hypergraph, context), Le(context.partition.epsilon));
+}
+
+TEST_F(APoolInitialPartitioner, ComputesTheSamePartitionIndependentOfTheNumberOfThreads) {
+  std::unique_ptr<Hypergraph> other_hypergraph = createHypergraph();
+  const std::vector<PartitionID> sequential = partitionWithThreads(*hypergraph, 1);
+  const std::vector<PartitionID> parallel = partitionWithThreads(*other_hypergraph, 3);
+  ASSERT_THAT(parallel, Eq(sequential));
+  ASSERT_THAT(metrics::km1(*other_hypergraph), Eq(metrics::km1(*hypergraph)));
+}
+}  // namespace kahypar
@@ -104,6 +104,32 @@ class APartitionedHypergraph : public Test {
   std::unique_ptr<IRefiner> refiner;
 };
 
+class AnImbalanceTracker : public Test {
+ public:
+  AnImbalanceTracker() :
+    hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+               HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }, 3),
+    context(),
+    tracker(hypergraph, context) {
+    context.partition.k = 3;
+    context.partition.epsilon = 0.03;
+    context.setupPartWeights(hypergraph.totalWeight());
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, hn % 3);
+    }
+    tracker.initialize();
+  }
+
+  void moveHypernode(const HypernodeID hn, const PartitionID to_part) {
+    const PartitionID from_part = hypergraph.partID(hn);
+    hypergraph.changeNodePart(hn, from_part, to_part);
+    tracker.update(from_part, to_part);
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+  ImbalanceTracker tracker;
+};
 
 TEST_F(AnUnPartitionedHypergraph, HasHyperedgeCutZero) {
   ASSERT_THAT(hyperedgeCut(hypergraph), Eq(0));
@@ -120,5 +146,24 @@ TEST_F(TheDemoHypergraph, HasAvgHyperedgeDegree3) {
 TEST_F(TheDemoHypergraph, HasAvgHypernodeDegree12Div7) {
   ASSERT_THAT(avgHypernodeDegree(hypergraph), DoubleEq(12.0 / 7));
 }
+
+TEST_F(AnImbalanceTracker, HasSameImbalanceAsPartition) {
+  ASSERT_THAT(tracker.imbalance(), Eq(imbalance(hypergraph, context)));
+}
+
+TEST_F(AnImbalanceTracker, UpdatesImbalanceIfHeaviestBlockGetsHeavier) {
+  moveHypernode(1, 0);
+  moveHypernode(2, 0);
+  ASSERT_THAT(tracker.imbalance(), Eq(imbalance(hypergraph, context)));
+  ASSERT_THAT(tracker.imbalance(), DoubleEq(5.0 / 3 - 1.0));
+}
+
+TEST_F(AnImbalanceTracker, UpdatesImbalanceIfHeaviestBlockGetsLighter) {
+  moveHypernode(1, 0);
+  moveHypernode(1, 2);
+  moveHypernode(0, 1);
+  ASSERT_THAT(tracker.imbalance(), Eq(imbalance(hypergraph, context)));
+  ASSERT_THAT(tracker.imbalance(), DoubleEq(3.0 / 3 - 1.0));
+}
 }  // namespace metrics
 }  // namespace kahypar
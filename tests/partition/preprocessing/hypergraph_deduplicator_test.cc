@@ -18,6 +18,9 @@
  *
  ******************************************************************************/
 
+#include <random>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 
@@ -25,6 +28,9 @@
 
 #include "kahypar/partition/preprocessing/hypergraph_deduplicator.h"
 
+using ::testing::Eq;
+using ::testing::Ge;
+
 
 namespace kahypar {
 TEST(TheHypergraphDeduplicator, DoesNothingWhenThereIsNothingToDeduplicate) {
@@ -85,4 +91,52 @@ TEST(TheHypergraphDeduplicator, RestoresRedundancy) {
   ASSERT_EQ(hypergraph.currentNumNodes(), 5);
   ASSERT_EQ(hypergraph.nodeWeight(2), 1);
 }
+
+TEST(TheHypergraphDeduplicator, RemovesTheSameRedundancyInParallel) {
+  // Hypernodes 60..99 are copies of hypernodes 0..39 and
+  // every fourth hyperedge is a copy of its predecessor.
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<HypernodeID> random_node(0, 59);
+  HyperedgeIndexVector index_vector { 0 };
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < 200; ++he) {
+    if (he % 4 == 3) {
+      const size_t begin = index_vector[he - 1];
+      const size_t end = index_vector[he];
+      for (size_t i = begin; i < end; ++i) {
+        edge_vector.push_back(edge_vector[i]);
+      }
+    } else {
+      std::vector<HypernodeID> pins { random_node(gen), random_node(gen), random_node(gen) };
+      std::sort(pins.begin(), pins.end());
+      pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+      for (const HypernodeID pin : pins) {
+        edge_vector.push_back(pin);
+        if (pin < 40) {
+          edge_vector.push_back(pin + 60);
+        }
+      }
+    }
+    index_vector.push_back(edge_vector.size());
+  }
+  Hypergraph sequential(100, 200, index_vector, edge_vector);
+  Hypergraph parallel(100, 200, index_vector, edge_vector);
+
+  const auto sequential_nodes = ds::removeIdenticalNodes(sequential);
+  const auto parallel_nodes = ds::removeIdenticalNodes(parallel, 4);
+  ASSERT_THAT(parallel_nodes.size(), Eq(sequential_nodes.size()));
+  ASSERT_THAT(sequential_nodes.size(), Ge(40));
+  for (size_t i = 0; i < sequential_nodes.size(); ++i) {
+    ASSERT_THAT(parallel_nodes[i].u, Eq(sequential_nodes[i].u));
+    ASSERT_THAT(parallel_nodes[i].v, Eq(sequential_nodes[i].v));
+  }
+
+  const auto sequential_hes = ds::removeParallelHyperedges(sequential);
+  const auto parallel_hes = ds::removeParallelHyperedges(parallel, 4);
+  ASSERT_THAT(parallel_hes, Eq(sequential_hes));
+  ASSERT_THAT(sequential_hes.size(), Ge(50));
+  for (const HyperedgeID& he : sequential.edges()) {
+    ASSERT_THAT(parallel.edgeWeight(he), Eq(sequential.edgeWeight(he)));
+  }
+}
 }  // namespace kahypar
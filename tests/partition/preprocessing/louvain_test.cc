@@ -152,6 +152,30 @@ TEST_F(ALouvainAlgorithm, DoesOneLouvainPass) {
   ASSERT_LE(quality_before, quality_after);
 }
 
+TEST_F(ALouvainAlgorithm, DoesOneParallelLouvainPass) {
+  context.shared_memory.parallel_community_detection = true;
+  context.shared_memory.num_threads = 2;
+  Graph graph(hypergraph, context);
+  Modularity modularity(graph);
+  EdgeWeight quality_before = modularity.quality();
+  EdgeWeight quality_after = louvain->louvain_pass(graph, modularity);
+  ASSERT_LE(quality_before, quality_after);
+}
+
+TEST_F(ALouvainAlgorithm, ComputesTheSameCommunitiesOnABipartiteGraphView) {
+  Louvain<Modularity, false> materialized(hypergraph, context);
+  const EdgeWeight materialized_quality = materialized.run();
+
+  context.preprocessing.community_detection.stream_bipartite_graph = true;
+  Louvain<Modularity, false> view(hypergraph, context);
+  const EdgeWeight view_quality = view.run();
+
+  ASSERT_EQ(materialized_quality, view_quality);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_EQ(materialized.hypernodeClusterID(hn), view.hypernodeClusterID(hn));
+  }
+}
+
 TEST_F(ALouvainAlgorithm, AssingsMappingToNextLevelFinerGraph) {
   Graph graph(hypergraph, context);
   Modularity modularity(graph);
@@ -216,6 +240,34 @@ TEST(ALouvainKarateClub, DoesLouvainAlgorithm) {
   }
 }
 
+TEST(ALouvainKarateClub, ComputesTheSameCommunitiesIndependentOfTheNumberOfThreads) {
+  Context context;
+  context.partition.k = 2;
+  context.partition.graph_filename = "test_instances/karate_club.graph.hgr";
+  context.preprocessing.community_detection.max_pass_iterations = 100;
+  context.preprocessing.community_detection.min_eps_improvement = 0.0001;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::uniform;
+  context.shared_memory.parallel_community_detection = true;
+
+  Hypergraph hypergraph(
+    io::createHypergraphFromFile(context.partition.graph_filename,
+                                 context.partition.k));
+
+  context.shared_memory.num_threads = 1;
+  Louvain<Modularity, false> single_threaded(hypergraph, context);
+  const EdgeWeight single_threaded_quality = single_threaded.run();
+
+  context.shared_memory.num_threads = 4;
+  Louvain<Modularity, false> multi_threaded(hypergraph, context);
+  const EdgeWeight multi_threaded_quality = multi_threaded.run();
+
+  ASSERT_LE(std::abs(single_threaded_quality - multi_threaded_quality), Graph::kEpsilon);
+  ASSERT_GT(multi_threaded_quality, 0.3);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_EQ(single_threaded.hypernodeClusterID(hn), multi_threaded.hypernodeClusterID(hn));
+  }
+}
+
 TEST(Louvain, WorksOnGraphDSThatChangesHypergraphIntoGraph) {
   Context context;
 
@@ -54,4 +54,32 @@ TEST(TheLSHSparsifier, HandlesWeightedNodesAndEdges) {
   ASSERT_EQ(sparse_hypergraph.nodeWeight(4), 50);
   ASSERT_EQ(sparse_hypergraph.nodeWeight(5), 50);
 }
+
+TEST(TheMinHashPolicy, CalculatesTheSameSignaturesInBlocksAndInParallel) {
+  Hypergraph hypergraph = io::createHypergraphFromFile(
+    std::string("test_instances/karate_club.graph.hgr"), 2);
+  const uint32_t num_hashes = MinMurmurHashPolicy::kHashBlockSize + 3;
+  MinMurmurHashPolicy policy(num_hashes, 42);
+
+  HashStorage<MinMurmurHashPolicy::HashValue> sequential(num_hashes, hypergraph.initialNumNodes());
+  HashStorage<MinMurmurHashPolicy::HashValue> parallel(num_hashes, hypergraph.initialNumNodes());
+  sequential.reserve(num_hashes);
+  parallel.reserve(num_hashes);
+  policy(hypergraph, 0, hypergraph.initialNumNodes(), sequential);
+  policy(hypergraph, 0, hypergraph.initialNumNodes(), parallel, 4);
+
+  // reference: one pass over the incident hyperedges per hash function
+  const HashFuncVector<math::MurmurHash<uint32_t> > hash_funcs(num_hashes, 42);
+  for (uint32_t hash = 0; hash < num_hashes; ++hash) {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      MinMurmurHashPolicy::HashValue min_hash =
+        std::numeric_limits<MinMurmurHashPolicy::HashValue>::max();
+      for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+        min_hash = std::min(min_hash, hash_funcs[hash](he));
+      }
+      ASSERT_EQ(sequential[hash][hn], min_hash);
+      ASSERT_EQ(sequential[hash][hn], parallel[hash][hn]);
+    }
+  }
+}
 }  // namespace kahypar
@@ -18,10 +18,15 @@
  *
 ******************************************************************************/
 
+#include <limits>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_priority_queue_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 
 using ::testing::Test;
@@ -90,4 +95,74 @@ TEST_F(AKwayFMRefiner, KnowsIfAHyperedgeIsFullyActive) {
   refiner->fullUpdate(0, 0, 1, 0);
   ASSERT_THAT(refiner->_he_fully_active[0], Eq(true));
 }
+
+TEST_F(AKwayFMRefiner, UsesBucketQueuesIfAdaptivePriorityQueueSeesSmallGainRange) {
+  context.local_search.fm.priority_queue = FMPriorityQueue::adaptive;
+  context.local_search.fm.max_bucket_queue_gain = maxGain(*hypergraph);
+  ASSERT_THAT(BucketPriorityQueue::usesBucketQueues(maxGain(*hypergraph), context), Eq(true));
+}
+
+TEST_F(AKwayFMRefiner, UsesBinaryHeapsIfAdaptivePriorityQueueSeesLargeGainRange) {
+  context.local_search.fm.priority_queue = FMPriorityQueue::adaptive;
+  context.local_search.fm.max_bucket_queue_gain = maxGain(*hypergraph) - 1;
+  ASSERT_THAT(BucketPriorityQueue::usesBucketQueues(maxGain(*hypergraph), context), Eq(false));
+}
+
+TEST_F(AKwayFMRefiner, DoesNotAllocateBucketsForSaturatedGainRanges) {
+  context.local_search.fm.priority_queue = FMPriorityQueue::bucket_queue;
+  const HyperedgeWeight max_gain = maxGain(2, std::numeric_limits<HyperedgeWeight>::max());
+  ASSERT_THAT(BucketPriorityQueue::usesBucketQueues(max_gain, context), Eq(false));
+
+  BucketPriorityQueue::KWayPQ pq(context.partition.k);
+  BucketPriorityQueue::initialize(pq, hypergraph->initialNumNodes(), max_gain, context);
+  pq.insert(0, 1, max_gain);
+  pq.enablePart(1);
+  ASSERT_THAT(pq.maxKey(), Eq(max_gain));
+}
+
+TEST_F(AKwayFMRefiner, SaturatesMaxGainInsteadOfOverflowing) {
+  const HyperedgeWeight max_weight = std::numeric_limits<HyperedgeWeight>::max();
+  ASSERT_THAT(maxGain(3, max_weight / 2), Eq(max_weight));
+  ASSERT_THAT(maxGain(2, max_weight / 2), Eq(max_weight - 1));
+  ASSERT_THAT(maxGain(0, max_weight), Eq(0));
+}
+
+TEST_F(AKwayFMRefiner, OnlyRequiresMaxGainIfBucketQueuesMightBeUsed) {
+  context.local_search.fm.priority_queue = FMPriorityQueue::binary_heap;
+  ASSERT_THAT(requiresMaxGain(context), Eq(false));
+  context.local_search.fm.priority_queue = FMPriorityQueue::bucket_queue;
+  ASSERT_THAT(requiresMaxGain(context), Eq(true));
+  context.local_search.fm.priority_queue = FMPriorityQueue::adaptive;
+  ASSERT_THAT(requiresMaxGain(context), Eq(true));
+}
+
+TEST_F(AKwayFMRefiner, ImprovesCutUsingBucketQueues) {
+  hypergraph.reset(new Hypergraph(io::createHypergraphFromFile("test_instances/ibm01.hgr", 4)));
+  context.partition.k = 4;
+  context.partition.rb_upper_k = context.partition.k - 1;
+  context.partition.epsilon = 0.03;
+  context.partition.mode = Mode::direct_kway;
+  context.setupPartWeights(hypergraph->totalWeight());
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    hypergraph->setNodePart(hn, hn % context.partition.k);
+  }
+  hypergraph->initializeNumCutHyperedges();
+  const HyperedgeWeight initial_cut = metrics::hyperedgeCut(*hypergraph);
+
+  KWayFMRefiner<NumberOfFruitlessMovesStopsSearch, BucketPriorityQueue> bucket_refiner(*hypergraph,
+                                                                                       context);
+  bucket_refiner.initialize(maxGain(*hypergraph));
+  std::vector<HypernodeID> refinement_nodes;
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    refinement_nodes.push_back(hn);
+  }
+  Metrics metrics = { initial_cut, metrics::km1(*hypergraph),
+                      metrics::imbalance(*hypergraph, context) };
+  UncontractionGainChanges changes;
+  bucket_refiner.refine(refinement_nodes, { 0, 0 }, changes, metrics);
+
+  ASSERT_LT(metrics.cut, initial_cut);
+  ASSERT_THAT(metrics.cut, Eq(metrics::hyperedgeCut(*hypergraph)));
+  ASSERT_LE(metrics::imbalance(*hypergraph, context), context.partition.epsilon);
+}
 }  // namespace kahypar
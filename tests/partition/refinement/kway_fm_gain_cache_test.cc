@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/refinement/kway_fm_gain_cache.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+using SeparateGainCache = KwayGainCache<Gain, SeparateCacheElementStorage>;
+using ArenaGainCache = KwayGainCache<Gain, ArenaCacheElementStorage>;
+
+template <typename T>
+class AKwayGainCache : public Test {
+ public:
+  AKwayGainCache() :
+    gain_cache(10, 5) {
+    gain_cache.initialize();
+  }
+
+  std::vector<PartitionID> adjacentParts(const HypernodeID hn) const {
+    std::vector<PartitionID> parts(gain_cache.adjacentParts(hn).begin(),
+                                   gain_cache.adjacentParts(hn).end());
+    std::sort(parts.begin(), parts.end());
+    return parts;
+  }
+
+  T gain_cache;
+};
+
+typedef ::testing::Types<SeparateGainCache, ArenaGainCache> Implementations;
+
+TYPED_TEST_CASE(AKwayGainCache, Implementations);
+
+TYPED_TEST(AKwayGainCache, StoresInitializedEntries) {
+  this->gain_cache.initializeEntry(3, 1, 7);
+  this->gain_cache.initializeEntry(3, 4, -2);
+
+  ASSERT_THAT(this->gain_cache.entryExists(3, 1), Eq(true));
+  ASSERT_THAT(this->gain_cache.entryExists(3, 4), Eq(true));
+  ASSERT_THAT(this->gain_cache.entryExists(3, 2), Eq(false));
+  ASSERT_THAT(this->gain_cache.entry(3, 1), Eq(7));
+  ASSERT_THAT(this->gain_cache.entry(3, 4), Eq(-2));
+  ASSERT_THAT(this->adjacentParts(3), Eq(std::vector<PartitionID>({ 1, 4 })));
+}
+
+TYPED_TEST(AKwayGainCache, OnlyContainsHypernodesWithInitializedEntries) {
+  this->gain_cache.initializeEntry(3, 1, 7);
+
+  ASSERT_THAT(this->gain_cache.entryExists(3), Eq(true));
+  ASSERT_THAT(this->gain_cache.entryExists(2), Eq(false));
+  ASSERT_THAT(this->gain_cache.entryExists(2, 1), Eq(false));
+}
+
+TYPED_TEST(AKwayGainCache, DoesNotMixUpEntriesOfDifferentHypernodes) {
+  for (HypernodeID hn = 0; hn < 10; ++hn) {
+    this->gain_cache.initializeEntry(hn, hn % 5, hn);
+  }
+  for (HypernodeID hn = 0; hn < 10; ++hn) {
+    ASSERT_THAT(this->gain_cache.entry(hn, hn % 5), Eq(static_cast<Gain>(hn)));
+    ASSERT_THAT(this->adjacentParts(hn), Eq(std::vector<PartitionID>({ hn % 5 })));
+  }
+}
+
+TYPED_TEST(AKwayGainCache, RollsBackAllChangesSinceLastReset) {
+  this->gain_cache.initializeEntry(0, 1, 4);
+  this->gain_cache.initializeEntry(0, 2, 3);
+  this->gain_cache.initializeEntry(1, 0, -1);
+
+  this->gain_cache.updateExistingEntry(0, 1, 5);
+  this->gain_cache.removeEntryDueToConnectivityDecrease(0, 2);
+  this->gain_cache.addEntryDueToConnectivityIncrease(1, 3, 8);
+  this->gain_cache.updateEntryIfItExists(1, 0, 2);
+  this->gain_cache.updateEntryIfItExists(1, 4, 2);
+
+  ASSERT_THAT(this->gain_cache.entry(0, 1), Eq(9));
+  ASSERT_THAT(this->gain_cache.entryExists(0, 2), Eq(false));
+  ASSERT_THAT(this->gain_cache.entry(1, 3), Eq(8));
+  ASSERT_THAT(this->gain_cache.entry(1, 0), Eq(1));
+  ASSERT_THAT(this->gain_cache.entryExists(1, 4), Eq(false));
+
+  this->gain_cache.rollbackDelta();
+
+  ASSERT_THAT(this->gain_cache.entry(0, 1), Eq(4));
+  ASSERT_THAT(this->gain_cache.entry(0, 2), Eq(3));
+  ASSERT_THAT(this->gain_cache.entryExists(1, 3), Eq(false));
+  ASSERT_THAT(this->gain_cache.entry(1, 0), Eq(-1));
+  ASSERT_THAT(this->adjacentParts(0), Eq(std::vector<PartitionID>({ 1, 2 })));
+  ASSERT_THAT(this->adjacentParts(1), Eq(std::vector<PartitionID>({ 0 })));
+}
+
+TYPED_TEST(AKwayGainCache, KeepsChangesAfterDeltaReset) {
+  this->gain_cache.initializeEntry(5, 1, 4);
+  this->gain_cache.updateExistingEntry(5, 1, -6);
+  this->gain_cache.resetDelta();
+  this->gain_cache.rollbackDelta();
+
+  ASSERT_THAT(this->gain_cache.entry(5, 1), Eq(-2));
+}
+
+TYPED_TEST(AKwayGainCache, RemovesAllEntriesOnClear) {
+  this->gain_cache.initializeEntry(2, 1, 4);
+  this->gain_cache.initializeEntry(7, 3, 1);
+  this->gain_cache.clear();
+
+  ASSERT_THAT(this->gain_cache.entryExists(2, 1), Eq(false));
+  ASSERT_THAT(this->gain_cache.entryExists(7, 3), Eq(false));
+  ASSERT_THAT(this->gain_cache.entry(2, 1), Eq(TypeParam::kNotCached));
+}
+
+TEST(AnArenaCacheElementStorage, AllocatesElementsSeparatelyIfArenaExceedsMaxSize) {
+  ArenaCacheElementStorage<CacheElement<Gain> > fitting_storage(10, 5);
+  ArenaCacheElementStorage<CacheElement<Gain> > exceeding_storage(10, 5, 10);
+  fitting_storage.initialize();
+  exceeding_storage.initialize();
+
+  ASSERT_THAT(fitting_storage.usesArena(), Eq(true));
+  ASSERT_THAT(exceeding_storage.usesArena(), Eq(false));
+
+  exceeding_storage.getOrCreate(4)->add(2, 3);
+  ASSERT_THAT(exceeding_storage.contains(4), Eq(true));
+  ASSERT_THAT(exceeding_storage.contains(5), Eq(false));
+  ASSERT_THAT(exceeding_storage.get(4)->gain(2), Eq(3));
+}
+}  // namespace kahypar
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+using ::testing::Test;
+using ::testing::Eq;
+
+namespace kahypar {
+using KWayKMinusOneRefinerSimpleStopping = KWayKMinusOneRefiner<NumberOfFruitlessMovesStopsSearch>;
+
+// The gain cache is only initialized in parallel for at least 1000 hypernodes
+// per thread, so the test hypergraphs of this directory are too small.
+static Hypergraph createHypergraph(const PartitionID k) {
+  const HypernodeID num_hypernodes = 5000;
+  const HyperedgeID num_hyperedges = 7500;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    index_vector.push_back(edge_vector.size());
+    edge_vector.push_back(he % num_hypernodes);
+    edge_vector.push_back((he + 1 + he % 5) % num_hypernodes);
+    edge_vector.push_back((he + 7 + he % 11) % num_hypernodes);
+    if (he % 3 == 0) {
+      edge_vector.push_back((he * 13 + 29) % num_hypernodes);
+    }
+  }
+  index_vector.push_back(edge_vector.size());
+  return Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector, k);
+}
+
+class AKWayKMinusOneRefiner : public Test {
+ public:
+  AKWayKMinusOneRefiner() :
+    context(),
+    hypergraph(createHypergraph(8)) {
+    context.local_search.fm.max_number_of_fruitless_moves = 50;
+    context.partition.k = 8;
+    context.partition.rb_lower_k = 0;
+    context.partition.rb_upper_k = context.partition.k - 1;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.partition.mode = Mode::direct_kway;
+    context.setupPartWeights(hypergraph.totalWeight());
+
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, (hn / 7) % context.partition.k);
+    }
+    hypergraph.initializeNumCutHyperedges();
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(AKWayKMinusOneRefiner, InitializesTheSameGainCacheInParallel) {
+  Context sequential_context(context);
+  sequential_context.shared_memory.num_threads = 1;
+  KWayKMinusOneRefinerSimpleStopping sequential_refiner(hypergraph, sequential_context);
+  sequential_refiner.initialize(maxGain(hypergraph));
+
+  Context parallel_context(context);
+  parallel_context.shared_memory.num_threads = 4;
+  KWayKMinusOneRefinerSimpleStopping parallel_refiner(hypergraph, parallel_context);
+  parallel_refiner.initialize(maxGain(hypergraph));
+
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    std::vector<PartitionID> parts(sequential_refiner._gain_cache.adjacentParts(hn).begin(),
+                                   sequential_refiner._gain_cache.adjacentParts(hn).end());
+    std::vector<PartitionID> parallel_parts(parallel_refiner._gain_cache.adjacentParts(hn).begin(),
+                                            parallel_refiner._gain_cache.adjacentParts(hn).end());
+    std::sort(parts.begin(), parts.end());
+    std::sort(parallel_parts.begin(), parallel_parts.end());
+    ASSERT_THAT(parallel_parts, Eq(parts));
+    for (const PartitionID& part : parts) {
+      ASSERT_THAT(parallel_refiner._gain_cache.entry(hn, part),
+                  Eq(sequential_refiner._gain_cache.entry(hn, part)));
+    }
+  }
+}
+}  // namespace kahypar
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/flow/kway_hyperflowcutter_refiner.h"
+#include "kahypar/partition/refinement/flow/policies/flow_execution_policy.h"
+
+using ::testing::Test;
+
+namespace kahypar {
+using KWayHyperFlowCutterRefinerExponentialFlowExecution =
+  KWayHyperFlowCutterRefiner<ExponentialFlowExecution>;
+
+class AKWayHyperFlowCutterRefiner : public Test {
+ public:
+  AKWayHyperFlowCutterRefiner() :
+    context(),
+    hypergraph(io::createHypergraphFromFile("test_instances/ibm01.hgr", 8)),
+    changes() {
+    context.partition.k = 8;
+    context.partition.rb_lower_k = 0;
+    context.partition.rb_upper_k = context.partition.k - 1;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.partition.mode = Mode::direct_kway;
+    context.local_search.algorithm = RefinementAlgorithm::kway_hyperflow_cutter;
+    context.shared_memory.num_threads = 4;
+    context.setupPartWeights(hypergraph.totalWeight());
+
+    // round-robin assignment yields a balanced partition with many cut hyperedges
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, hn % context.partition.k);
+    }
+    hypergraph.initializeNumCutHyperedges();
+  }
+
+  bool refine(const bool parallel_flow_refinement) {
+    context.shared_memory.parallel_flow_refinement = parallel_flow_refinement;
+    Metrics metrics = { metrics::hyperedgeCut(hypergraph),
+                        metrics::km1(hypergraph),
+                        metrics::imbalance(hypergraph, context) };
+    std::vector<HypernodeID> refinement_nodes;
+    KWayHyperFlowCutterRefinerExponentialFlowExecution refiner(hypergraph, context);
+    refiner.initialize(0);
+    return refiner.refine(refinement_nodes, { 0, 0 }, changes, metrics);
+  }
+
+  void verifyBalanceConstraint() {
+    for (PartitionID part = 0; part < context.partition.k; ++part) {
+      ASSERT_LE(hypergraph.partWeight(part), context.partition.max_part_weights[part]);
+    }
+    ASSERT_LE(metrics::imbalance(hypergraph, context), context.partition.epsilon);
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  UncontractionGainChanges changes;
+};
+
+TEST_F(AKWayHyperFlowCutterRefiner, ImprovesConnectivityRefiningBlockPairsSequentially) {
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+
+  ASSERT_TRUE(refine(false));
+  ASSERT_LT(metrics::km1(hypergraph), initial_km1);
+  verifyBalanceConstraint();
+}
+
+TEST_F(AKWayHyperFlowCutterRefiner, ImprovesConnectivityRefiningBlockPairsInParallel) {
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+
+  ASSERT_TRUE(refine(true));
+  ASSERT_LT(metrics::km1(hypergraph), initial_km1);
+  verifyBalanceConstraint();
+}
+}  // namespace kahypar
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/parallel_kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+using ::testing::Test;
+using ::testing::Eq;
+
+namespace kahypar {
+using ParallelKWayKMinusOneRefinerSimpleStopping =
+  ParallelKWayKMinusOneRefiner<NumberOfFruitlessMovesStopsSearch>;
+
+class AParallelKWayKMinusOneRefiner : public Test {
+ public:
+  AParallelKWayKMinusOneRefiner() :
+    context(),
+    hypergraph(io::createHypergraphFromFile("test_instances/ibm01.hgr", 4)),
+    changes() {
+    context.local_search.fm.max_number_of_fruitless_moves = 50;
+    context.partition.k = 4;
+    context.partition.rb_lower_k = 0;
+    context.partition.rb_upper_k = context.partition.k - 1;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.partition.mode = Mode::direct_kway;
+    context.setupPartWeights(hypergraph.totalWeight());
+
+    // round-robin assignment yields a balanced partition with many cut hyperedges
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, hn % context.partition.k);
+    }
+    hypergraph.initializeNumCutHyperedges();
+  }
+
+  Metrics refine(const size_t num_threads) {
+    context.shared_memory.num_threads = num_threads;
+    Metrics metrics = { metrics::hyperedgeCut(hypergraph),
+                        metrics::km1(hypergraph),
+                        metrics::imbalance(hypergraph, context) };
+    std::vector<HypernodeID> refinement_nodes;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      refinement_nodes.push_back(hn);
+    }
+    ParallelKWayKMinusOneRefinerSimpleStopping refiner(hypergraph, context);
+    refiner.initialize(100);
+    refiner.refine(refinement_nodes, { 0, 0 }, changes, metrics);
+    return metrics;
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  UncontractionGainChanges changes;
+};
+
+TEST_F(AParallelKWayKMinusOneRefiner, ClaimsEachHypernodeOnlyOncePerRound) {
+  ParallelKWayKMinusOneRefinerSimpleStopping refiner(hypergraph, context);
+  refiner.startNewRound();
+  ASSERT_TRUE(refiner.claim(0));
+  ASSERT_FALSE(refiner.claim(0));
+  ASSERT_TRUE(refiner.isClaimed(0));
+  ASSERT_FALSE(refiner.isClaimed(1));
+
+  refiner.startNewRound();
+  ASSERT_FALSE(refiner.isClaimed(0));
+  ASSERT_TRUE(refiner.claim(0));
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, ResetsAllPartDeltasOfRolledBackSearches) {
+  // Moving 0 or 1 to block 1 has gain -1. Therefore each search performs
+  // a single move that is rolled back, because it is not part of the best prefix.
+  HyperedgeWeightVector he_weights = { 2, 1, 2, 1 };
+  Hypergraph small_hypergraph(4, 4, HyperedgeIndexVector { 0, 2, 4, 6,  /*sentinel*/ 8 },
+                              HyperedgeVector { 0, 1, 0, 2, 2, 3, 1, 3 }, 2, &he_weights);
+  small_hypergraph.setNodePart(0, 0);
+  small_hypergraph.setNodePart(1, 0);
+  small_hypergraph.setNodePart(2, 1);
+  small_hypergraph.setNodePart(3, 1);
+  small_hypergraph.initializeNumCutHyperedges();
+  Context small_context(context);
+  small_context.partition.k = 2;
+  small_context.partition.rb_upper_k = 1;
+  small_context.partition.epsilon = 1.0;
+  small_context.local_search.fm.max_number_of_fruitless_moves = 1;
+  small_context.setupPartWeights(small_hypergraph.totalWeight());
+
+  ParallelKWayKMinusOneRefinerSimpleStopping refiner(small_hypergraph, small_context);
+  ParallelKWayKMinusOneRefinerSimpleStopping::LocalizedSearch search(small_hypergraph,
+                                                                      small_context);
+  refiner.startNewRound();
+  ASSERT_TRUE(search.search(0, refiner).empty());
+  ASSERT_TRUE(search.search(1, refiner).empty());
+  ASSERT_TRUE(refiner.isClaimed(0));
+  ASSERT_TRUE(refiner.isClaimed(1));
+
+  search.reset();
+  for (PartitionID part = 0; part < small_context.partition.k; ++part) {
+    ASSERT_THAT(search._part_weight_delta[part], Eq(0));
+    ASSERT_THAT(search._part_size_delta[part], Eq(0));
+  }
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, DoesNotClaimHypernodesThatWouldEmptyTheirBlock) {
+  // Moving 0 to block 1 removes both cut hyperedges, but would leave block 0 empty.
+  Hypergraph small_hypergraph(3, 2, HyperedgeIndexVector { 0, 2,  /*sentinel*/ 4 },
+                              HyperedgeVector { 0, 1, 0, 2 }, 2);
+  small_hypergraph.setNodePart(0, 0);
+  small_hypergraph.setNodePart(1, 1);
+  small_hypergraph.setNodePart(2, 1);
+  small_hypergraph.initializeNumCutHyperedges();
+  Context small_context(context);
+  small_context.partition.k = 2;
+  small_context.partition.rb_upper_k = 1;
+  small_context.partition.epsilon = 1.0;
+  small_context.setupPartWeights(small_hypergraph.totalWeight());
+
+  ParallelKWayKMinusOneRefinerSimpleStopping refiner(small_hypergraph, small_context);
+  ParallelKWayKMinusOneRefinerSimpleStopping::LocalizedSearch search(small_hypergraph,
+                                                                      small_context);
+  refiner.startNewRound();
+  ASSERT_TRUE(search.search(0, refiner).empty());
+  ASSERT_FALSE(refiner.isClaimed(0));
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, ImprovesConnectivityUsingASingleThread) {
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+  const Metrics metrics = refine(1);
+
+  ASSERT_LT(metrics.km1, initial_km1);
+  ASSERT_THAT(metrics.km1, Eq(metrics::km1(hypergraph)));
+  ASSERT_LE(metrics::imbalance(hypergraph, context), context.partition.epsilon);
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, ImprovesConnectivityUsingMultipleThreads) {
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+  const Metrics metrics = refine(4);
+
+  ASSERT_LT(metrics.km1, initial_km1);
+  ASSERT_THAT(metrics.km1, Eq(metrics::km1(hypergraph)));
+  ASSERT_LE(metrics::imbalance(hypergraph, context), context.partition.epsilon);
+  for (PartitionID part = 0; part < context.partition.k; ++part) {
+    ASSERT_GT(hypergraph.partSize(part), 0);
+  }
+}
+}  // namespace kahypar
@@ -72,6 +72,24 @@ TEST_F(AQuotientGraphBlockScheduler, HasCorrectQuotientGraphEdges) {
   }
 }
 
+TEST_F(AQuotientGraphBlockScheduler, SplitsQuotientGraphEdgesIntoMatchings) {
+  scheduler->buildQuotientGraph();
+  std::vector<std::pair<PartitionID, PartitionID> > edges;
+  for (const auto& e : scheduler->quotientGraphEdges()) {
+    edges.push_back(e);
+  }
+
+  const auto matchings = scheduler->computeMatchings(edges);
+
+  ASSERT_EQ(matchings.size(), 3);
+  ASSERT_EQ(matchings[0], (std::vector<std::pair<PartitionID, PartitionID> > {
+    std::make_pair(0, 1), std::make_pair(2, 3) }));
+  ASSERT_EQ(matchings[1], (std::vector<std::pair<PartitionID, PartitionID> > {
+    std::make_pair(0, 2) }));
+  ASSERT_EQ(matchings[2], (std::vector<std::pair<PartitionID, PartitionID> > {
+    std::make_pair(0, 3), std::make_pair(1, 2) }));
+}
+
 TEST_F(AQuotientGraphBlockScheduler, HasCorrectCutHyperedges) {
   scheduler->buildQuotientGraph();
 
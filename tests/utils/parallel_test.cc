@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/utils/parallel.h"
+
+using ::testing::Eq;
+
+namespace kahypar {
+namespace parallel {
+TEST(ATaskPool, ExecutesAllTasksSpawnedBeforeRun) {
+  TaskPool pool(4);
+  std::vector<int> executed(100, 0);
+  for (size_t i = 0; i < executed.size(); ++i) {
+    pool.spawn(0, [&executed, i](const size_t) {
+        ++executed[i];
+      });
+  }
+  pool.run();
+  for (const int count : executed) {
+    ASSERT_THAT(count, Eq(1));
+  }
+}
+
+TEST(ATaskPool, ExecutesRecursivelySpawnedTasks) {
+  TaskPool pool(4);
+  std::atomic<size_t> num_leaves(0);
+  std::function<void(const size_t, const size_t)> split;
+  split = [&](const size_t depth, const size_t thread_id) {
+            if (depth == 10) {
+              ++num_leaves;
+              return;
+            }
+            for (size_t i = 0; i < 2; ++i) {
+              pool.spawn(thread_id, [&split, depth](const size_t tid) {
+                  split(depth + 1, tid);
+                });
+            }
+          };
+  pool.spawn(0, [&split](const size_t tid) {
+      split(0, tid);
+    });
+  pool.run();
+  ASSERT_THAT(num_leaves.load(), Eq(1024));
+}
+
+TEST(ATaskPool, RunsTasksOnTheCallingThreadIfOnlyOneThreadIsUsed) {
+  TaskPool pool(1);
+  size_t num_tasks = 0;
+  std::function<void(const size_t)> task = [&](const size_t thread_id) {
+                                              ASSERT_THAT(thread_id, Eq(0));
+                                              if (++num_tasks < 5) {
+                                                pool.spawn(thread_id, task);
+                                              }
+                                            };
+  pool.spawn(0, task);
+  pool.run();
+  ASSERT_THAT(num_tasks, Eq(5));
+}
+
+TEST(AParallelSort, SortsLikeStdSort) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 100);
+  for (const size_t size : { 0, 1, 5, 1000, 1001 }) {
+    for (const size_t num_threads : { 1, 3, 4, 8 }) {
+      std::vector<int> values(size);
+      for (int& value : values) {
+        value = dist(gen);
+      }
+      std::vector<int> expected = values;
+      std::sort(expected.begin(), expected.end());
+      sort(values.begin(), values.end(), num_threads, std::less<int>());
+      ASSERT_THAT(values, Eq(expected));
+    }
+  }
+}
+}  // namespace parallel
+}  // namespace kahypar